@@ -0,0 +1,190 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#ifndef HB_PERF_HH
+#define HB_PERF_HH
+
+#include <hb.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef SRCDIR
+#define SRCDIR "."
+#endif
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+#define HB_PERF_HAVE_ALLOCATION_STATS 1
+#include <malloc.h>
+#endif
+
+/* Shared helpers for the benchmarks in this directory.  Paths are
+ * relative to perf/, so the programs can be run from anywhere. */
+
+static inline double
+hb_perf_now_ns (void)
+{
+  typedef std::chrono::steady_clock clock;
+  return std::chrono::duration<double, std::nano> (clock::now ().time_since_epoch ()).count ();
+}
+
+/* Allocation statistics.  With glibc, the benchmarks interpose malloc()
+ * and friends to count calls and track the bytes in use; elsewhere the
+ * numbers stay zero and hb_perf_have_allocation_stats() says so. */
+
+struct hb_perf_allocation_stats_t
+{
+  unsigned long long calls;
+  size_t live_bytes;
+  size_t peak_bytes;
+};
+
+static hb_perf_allocation_stats_t hb_perf_allocation_stats;
+
+static inline bool
+hb_perf_have_allocation_stats (void)
+{
+#ifdef HB_PERF_HAVE_ALLOCATION_STATS
+  return true;
+#else
+  return false;
+#endif
+}
+
+/* Starts a new measurement: zeroes the call count and makes the
+ * current usage the baseline for the peak. */
+static inline void
+hb_perf_allocation_stats_reset (void)
+{
+  hb_perf_allocation_stats.calls = 0;
+  hb_perf_allocation_stats.peak_bytes = hb_perf_allocation_stats.live_bytes;
+}
+
+#ifdef HB_PERF_HAVE_ALLOCATION_STATS
+extern "C" {
+extern void *__libc_malloc (size_t size);
+extern void *__libc_calloc (size_t nmemb, size_t size);
+extern void *__libc_realloc (void *ptr, size_t size);
+extern void __libc_free (void *ptr);
+
+/* Memory libc allocated internally, strdup() for example, was never
+ * counted; don't let freeing it wrap the total around. */
+static inline void
+hb_perf_allocation_untrack (size_t size)
+{
+  if (hb_perf_allocation_stats.live_bytes > size)
+    hb_perf_allocation_stats.live_bytes -= size;
+  else
+    hb_perf_allocation_stats.live_bytes = 0;
+}
+
+static inline void
+hb_perf_allocation_track (void *ptr, size_t old_size)
+{
+  hb_perf_allocation_stats.calls++;
+  hb_perf_allocation_untrack (old_size);
+  if (ptr)
+    hb_perf_allocation_stats.live_bytes += malloc_usable_size (ptr);
+  if (hb_perf_allocation_stats.live_bytes > hb_perf_allocation_stats.peak_bytes)
+    hb_perf_allocation_stats.peak_bytes = hb_perf_allocation_stats.live_bytes;
+}
+
+void *
+malloc (size_t size)
+{
+  void *ptr = __libc_malloc (size);
+  hb_perf_allocation_track (ptr, 0);
+  return ptr;
+}
+
+void *
+calloc (size_t nmemb, size_t size)
+{
+  void *ptr = __libc_calloc (nmemb, size);
+  hb_perf_allocation_track (ptr, 0);
+  return ptr;
+}
+
+void *
+realloc (void *ptr, size_t size)
+{
+  size_t old_size = ptr ? malloc_usable_size (ptr) : 0;
+  void *new_ptr = __libc_realloc (ptr, size);
+  if (new_ptr || !size)
+    hb_perf_allocation_track (new_ptr, old_size);
+  return new_ptr;
+}
+
+void
+free (void *ptr)
+{
+  if (ptr)
+    hb_perf_allocation_untrack (malloc_usable_size (ptr));
+  __libc_free (ptr);
+}
+}
+#endif
+
+
+static inline hb_blob_t *
+hb_perf_open_blob (const char *path)
+{
+  char full_path[1024];
+  snprintf (full_path, sizeof (full_path), "%s/%s", SRCDIR, path);
+  hb_blob_t *blob = hb_blob_create_from_file (full_path);
+  if (!hb_blob_get_length (blob))
+  {
+    fprintf (stderr, "Failed to open %s\n", full_path);
+    exit (1);
+  }
+  return blob;
+}
+
+static inline hb_face_t *
+hb_perf_open_face (const char *path)
+{
+  hb_blob_t *blob = hb_perf_open_blob (path);
+  hb_face_t *face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+  return face;
+}
+
+/* Returns an unshaped buffer holding the contents of a UTF-8 text file. */
+static inline hb_buffer_t *
+hb_perf_open_text (const char *path)
+{
+  hb_blob_t *blob = hb_perf_open_blob (path);
+  unsigned int len;
+  const char *text = hb_blob_get_data (blob, &len);
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, text, len, 0, len);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_blob_destroy (blob);
+  return buffer;
+}
+
+#endif /* HB_PERF_HH */
@@ -0,0 +1,80 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-perf.hh"
+
+/* Times hb_font_get_nominal_glyph() over running text, which is what
+ * the shaper does for every character before anything else. */
+
+static const struct
+{
+  const char *name;
+  const char *font;
+  const char *text;
+} cases[] =
+{
+  {"latin", "../test/subset/data/fonts/Roboto-Regular.ttf", "texts/en-alice.txt"},
+  {"cjk", "../test/subset/data/fonts/Mplus1p-Regular.ttf", "texts/ja-neko.txt"},
+};
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 2000;
+
+  printf ("{\n  \"benchmark\": \"cmap\",\n  \"iterations\": %u,\n  \"results\": [", iterations);
+  for (unsigned int i = 0; i < sizeof (cases) / sizeof (cases[0]); i++)
+  {
+    hb_face_t *face = hb_perf_open_face (cases[i].font);
+    hb_font_t *font = hb_font_create (face);
+    hb_buffer_t *buffer = hb_perf_open_text (cases[i].text);
+
+    unsigned int len;
+    const hb_glyph_info_t *info = hb_buffer_get_glyph_infos (buffer, &len);
+
+    unsigned int found = 0;
+    double start = hb_perf_now_ns ();
+    for (unsigned int n = 0; n < iterations; n++)
+      for (unsigned int j = 0; j < len; j++)
+      {
+	hb_codepoint_t glyph;
+	found += hb_font_get_nominal_glyph (font, info[j].codepoint, &glyph);
+      }
+    double elapsed = hb_perf_now_ns () - start;
+
+    printf ("%s\n    {\"name\": \"%s\", \"chars\": %u, \"found\": %u, \"ns_per_lookup\": %.2f}",
+	    i ? "," : "",
+	    cases[i].name, len, found / iterations,
+	    elapsed / ((double) iterations * len));
+
+    hb_buffer_destroy (buffer);
+    hb_font_destroy (font);
+    hb_face_destroy (face);
+  }
+  printf ("\n  ]\n}\n");
+
+  return 0;
+}
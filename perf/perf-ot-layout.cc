@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-ot-layout.hh"
+#include "hb-perf.hh"
+
+/* Builds the GSUB and GPOS lookup accelerators of the perf-shape fonts
+ * and reports how long that takes and how much memory the compiled class
+ * arrays in them, and the glyph-to-lookups index, use.  Coverage bitmaps
+ * are only compiled as shaping uses them, so building leaves none.
+ *
+ * Reads internal state, so this program links the libraries
+ * statically. */
+
+static const char *fonts[] =
+{
+  "../test/subset/data/fonts/Roboto-Regular.ttf",
+  "../test/shaping/data/text-rendering-tests/fonts/TestShapeAran.ttf",
+  "../test/shaping/data/in-house/fonts/1a5face3fcbd929d228235c2f72bbd6f8eb37424.ttf",
+  "../test/shaping/data/in-house/fonts/a6c76d1bafde4a0b1026ebcc932d2e5c6fd02442.ttf",
+  "../test/subset/data/fonts/Mplus1p-Regular.ttf",
+  "../test/shaping/data/text-rendering-tests/fonts/Zycon.ttf",
+};
+
+static const hb_tag_t tables[] = {HB_OT_TAG_GSUB, HB_OT_TAG_GPOS};
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 20;
+
+  printf ("{\n  \"benchmark\": \"ot-layout\",\n  \"iterations\": %u,\n  \"results\": [", iterations);
+  for (unsigned int i = 0; i < ARRAY_LENGTH (fonts); i++)
+  {
+    hb_blob_t *blob = hb_perf_open_blob (fonts[i]);
+    hb_face_t *face = hb_face_create (blob, 0);
+
+    const char *font_name = strrchr (fonts[i], '/') + 1;
+    printf ("%s\n    {\"font\": \"%s\"", i ? "," : "", font_name);
+    for (unsigned int j = 0; j < ARRAY_LENGTH (tables); j++)
+    {
+      /* A fresh face each time, with the other table and the face data
+       * already loaded, so only this table's accelerators are timed. */
+      double elapsed = 0.;
+      unsigned int coverage_bytes = 0, class_bytes = 0, index_bytes = 0;
+      for (unsigned int n = 0; n < iterations; n++)
+      {
+	hb_face_t *fresh_face = hb_face_create (blob, 0);
+	hb_ot_layout_get_accelerator_memory (fresh_face, tables[1 - j], &coverage_bytes, &class_bytes, &index_bytes);
+
+	double start = hb_perf_now_ns ();
+	hb_ot_layout_get_accelerator_memory (fresh_face, tables[j], &coverage_bytes, &class_bytes, &index_bytes);
+	elapsed += hb_perf_now_ns () - start;
+
+	hb_face_destroy (fresh_face);
+      }
+
+      printf (", \"%c%c%c%c\": {\"lookups\": %u, \"build_ns\": %.0f, "
+	      "\"class_cache_bytes\": %u, \"lookup_index_bytes\": %u}",
+	      HB_UNTAG (tables[j]),
+	      hb_ot_layout_table_get_lookup_count (face, tables[j]),
+	      elapsed / iterations, class_bytes, index_bytes);
+    }
+    printf ("}");
+
+    hb_face_destroy (face);
+    hb_blob_destroy (blob);
+  }
+  printf ("\n  ]\n}\n");
+
+  return 0;
+}
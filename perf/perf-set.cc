@@ -0,0 +1,337 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-set.hh"
+#include "hb-perf.hh"
+
+/* Times the hb_set_t page kernels that have SIMD versions, the generic
+ * ones against those this build picked, over a few thousand pages of
+ * random bits; then the set operations built on them, over glyph sets the
+ * size of a large font's, and over a set of long runs, which is held as
+ * ranges.  Each figure is the median of ROUNDS rounds; the generic and
+ * the SIMD rounds of a kernel alternate, so that they see the same
+ * machine.
+ *
+ * Uses internal types, so this program links the libraries statically. */
+
+#if defined(HB_SIMD_SSE2)
+typedef hb_set_page_sse2_t simd_t;
+static const char simd_name[] = "sse2";
+#else
+typedef hb_set_page_generic_t simd_t;
+static const char simd_name[] = "none";
+#endif
+
+typedef hb_set_page_generic_t::elt_t elt_t;
+enum { NUM_PAGES = 4096, ELTS = hb_set_page_generic_t::ELTS };
+enum { ROUNDS = 11 };
+
+static elt_t a[NUM_PAGES * ELTS];
+/* Read through on every pass, so the compiler can't hoist the kernels
+ * out of the iterations loop. */
+static const elt_t * volatile pages = a;
+static volatile unsigned int sink;
+
+static elt_t
+random_elt (void)
+{
+  /* Some zero words, so the nonzero_words kernel sees both kinds. */
+  if (rand () % 4 == 0)
+    return 0;
+  elt_t v = 0;
+  for (unsigned int i = 0; i < 4; i++)
+    v = (v << 16) ^ (elt_t) rand ();
+  return v;
+}
+
+static int
+compare_doubles (const void *pa, const void *pb)
+{
+  double a = * (const double *) pa, b = * (const double *) pb;
+  return a < b ? -1 : a > b ? 1 : 0;
+}
+
+static double
+median (double *samples, unsigned int count)
+{
+  qsort (samples, count, sizeof (samples[0]), compare_doubles);
+  return samples[count / 2];
+}
+
+/* Runs a loop iterations times; returns ns per iteration, or per item
+ * where the timer says so. */
+typedef double (*timer_func_t) (unsigned int iterations);
+
+static double
+time_median (timer_func_t timer, unsigned int iterations)
+{
+  double samples[ROUNDS];
+  for (unsigned int r = 0; r < ROUNDS; r++)
+    samples[r] = timer (iterations);
+  return median (samples, ROUNDS);
+}
+
+/* Returns ns per page. */
+template <typename Ops>
+static double
+time_population (unsigned int iterations)
+{
+  unsigned int sum = 0;
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    const elt_t *p = pages;
+    for (unsigned int i = 0; i < NUM_PAGES; i++)
+      sum += Ops::get_population (p + i * ELTS);
+  }
+  sink += sum;
+  return (hb_perf_now_ns () - start) / iterations / NUM_PAGES;
+}
+
+template <typename Ops>
+static double
+time_nonzero_words (unsigned int iterations)
+{
+  unsigned int sum = 0;
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    const elt_t *p = pages;
+    for (unsigned int i = 0; i < NUM_PAGES; i++)
+      sum += Ops::nonzero_words (p + i * ELTS);
+  }
+  sink += sum;
+  return (hb_perf_now_ns () - start) / iterations / NUM_PAGES;
+}
+
+static void
+print_kernel (const char *name,
+	      timer_func_t generic, timer_func_t simd,
+	      unsigned int iterations,
+	      bool last = false)
+{
+  double generic_ns[ROUNDS], simd_ns[ROUNDS];
+  for (unsigned int r = 0; r < ROUNDS; r++)
+  {
+    generic_ns[r] = generic (iterations);
+    simd_ns[r] = simd (iterations);
+  }
+  double g = median (generic_ns, ROUNDS);
+  double s = median (simd_ns, ROUNDS);
+  printf ("    \"%s\": {\"generic_ns\": %.2f, \"simd_ns\": %.2f, \"speedup\": %.2f}%s\n",
+	  name, g, s, s > 0. ? g / s : 0., last ? "" : ",");
+}
+
+/* A set of about one in every `every' glyphs below num_glyphs. */
+static void
+random_set (hb_set_t *set, unsigned int num_glyphs, unsigned int every)
+{
+  for (unsigned int g = 0; g < num_glyphs; g++)
+    if (rand () % every == 0)
+      set->add (g);
+}
+
+static hb_set_t dense, sparse, runs, t;
+static size_t runs_bytes;
+static unsigned int num_ranges;
+
+static double
+time_union (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    t.set (&dense);
+    t.union_ (&sparse);
+  }
+  return (hb_perf_now_ns () - start) / iterations;
+}
+
+static double
+time_intersect (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    t.set (&dense);
+    t.intersect (&sparse);
+  }
+  return (hb_perf_now_ns () - start) / iterations;
+}
+
+static double
+time_subtract (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    t.set (&dense);
+    t.subtract (&sparse);
+  }
+  return (hb_perf_now_ns () - start) / iterations;
+}
+
+static double
+time_set_population (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    t.set (&dense);
+    sink += t.get_population ();
+  }
+  return (hb_perf_now_ns () - start) / iterations;
+}
+
+/* Returns ns per glyph. */
+static double
+time_next (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    hb_codepoint_t g = HB_SET_VALUE_INVALID;
+    while (sparse.next (&g))
+      sink += g;
+  }
+  return (hb_perf_now_ns () - start) / iterations / sparse.get_population ();
+}
+
+/* A set of runs: all of Unicode but for a few codepoints, as
+ * hb_face_collect_unicodes() gives for a font with a large cmap. */
+static double
+time_build_runs (unsigned int iterations)
+{
+  double ns = 0.;
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    runs.fini ();
+    hb_perf_allocation_stats_reset ();
+    size_t live_bytes = hb_perf_allocation_stats.live_bytes;
+    double start = hb_perf_now_ns ();
+    runs.init ();
+    runs.add_range (0, 0x10FFFF);
+    for (hb_codepoint_t u = 0x0300; u < 0x0340; u++)
+      runs.del (u * 17);
+    ns += hb_perf_now_ns () - start;
+    runs_bytes = hb_perf_allocation_stats.peak_bytes - live_bytes;
+  }
+  return ns / iterations;
+}
+
+static double
+time_runs_union (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    t.set (&runs);
+    t.union_ (&sparse);
+  }
+  return (hb_perf_now_ns () - start) / iterations;
+}
+
+/* Returns ns per range. */
+static double
+time_next_range (unsigned int iterations)
+{
+  double start = hb_perf_now_ns ();
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    hb_codepoint_t first = HB_SET_VALUE_INVALID, last = HB_SET_VALUE_INVALID;
+    num_ranges = 0;
+    while (runs.next_range (&first, &last))
+      num_ranges++;
+  }
+  return (hb_perf_now_ns () - start) / iterations / num_ranges;
+}
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 1000;
+
+  srand (1);
+  for (unsigned int i = 0; i < ARRAY_LENGTH (a); i++)
+    a[i] = random_elt ();
+
+  printf ("{\n  \"benchmark\": \"set\",\n  \"iterations\": %u,\n  \"rounds\": %u,\n  \"simd\": \"%s\",\n",
+	  iterations, ROUNDS, simd_name);
+
+  /* The other kernels are generic in every build. */
+  printf ("  \"page_kernels\": {\n");
+  print_kernel ("population",
+		time_population<hb_set_page_generic_t>,
+		time_population<simd_t>,
+		iterations);
+  print_kernel ("nonzero_words",
+		time_nonzero_words<hb_set_page_generic_t>,
+		time_nonzero_words<simd_t>,
+		iterations, true);
+  printf ("  },\n");
+
+  /* Whole sets, as the closure and subsetting code uses them: a dense
+   * and a sparse glyph set of a 65536-glyph font. */
+  dense.init ();
+  sparse.init ();
+  runs.init ();
+  t.init ();
+  random_set (&dense, 65536, 2);
+  random_set (&sparse, 65536, 61);
+
+  unsigned int set_iterations = iterations * 10;
+  double union_ns = time_median (time_union, set_iterations);
+  double intersect_ns = time_median (time_intersect, set_iterations);
+  double subtract_ns = time_median (time_subtract, set_iterations);
+  double population_ns = time_median (time_set_population, set_iterations);
+  double next_ns = time_median (time_next, iterations);
+
+  printf ("  \"sets\": {\"dense_population\": %u, \"sparse_population\": %u, "
+	  "\"union_ns\": %.0f, \"intersect_ns\": %.0f, \"subtract_ns\": %.0f, "
+	  "\"population_ns\": %.0f, \"next_ns_per_glyph\": %.2f},\n",
+	  dense.get_population (), sparse.get_population (),
+	  union_ns, intersect_ns, subtract_ns, population_ns, next_ns);
+
+  double build_ns = time_median (time_build_runs, iterations);
+  double runs_union_ns = time_median (time_runs_union, set_iterations);
+  double next_range_ns = time_median (time_next_range, set_iterations);
+
+  printf ("  \"runs\": {\"population\": %u, \"ranges\": %u, \"build_ns\": %.0f, ",
+	  runs.get_population (), num_ranges, build_ns);
+  if (hb_perf_have_allocation_stats ())
+    printf ("\"bytes\": %zu, ", runs_bytes);
+  else
+    printf ("\"bytes\": null, ");
+  printf ("\"union_sparse_ns\": %.0f, \"next_range_ns\": %.2f}\n}\n",
+	  runs_union_ns, next_range_ns);
+
+  dense.fini ();
+  sparse.fini ();
+  t.fini ();
+  runs.fini ();
+
+  return 0;
+}
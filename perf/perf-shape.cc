@@ -0,0 +1,241 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-perf.hh"
+
+#include <string.h>
+
+/* Times hb_shape() over a text in a few scripts, one call per line, the
+ * way a layout engine would shape paragraphs, and per word against
+ * hb_shape_batch().  Besides the time per glyph, it reports how many
+ * allocations each call makes once warmed up, how well the face's
+ * shape-plan cache does, and what the normalization stage costs per
+ * glyph. */
+
+static const struct
+{
+  const char *name;
+  const char *font;
+  const char *text;
+} cases[] =
+{
+  {"latin", "../test/subset/data/fonts/Roboto-Regular.ttf", "texts/en-alice.txt"},
+  {"latin-1", "../test/subset/data/fonts/Roboto-Regular.ttf", "texts/de-erlkoenig.txt"},
+  {"arabic", "../test/shaping/data/text-rendering-tests/fonts/TestShapeAran.ttf", "texts/ur-words.txt"},
+  {"devanagari", "../test/shaping/data/in-house/fonts/1a5face3fcbd929d228235c2f72bbd6f8eb37424.ttf", "texts/hi-vowels.txt"},
+  {"myanmar", "../test/shaping/data/in-house/fonts/a6c76d1bafde4a0b1026ebcc932d2e5c6fd02442.ttf", "texts/my-kinzi.txt"},
+  {"cjk", "../test/subset/data/fonts/Mplus1p-Regular.ttf", "texts/ja-neko.txt"},
+  {"emoji", "../test/shaping/data/text-rendering-tests/fonts/Zycon.ttf", "texts/emoji.txt"},
+};
+
+struct line_t
+{
+  const char *text;
+  int len;
+};
+
+struct normalize_stats_t
+{
+  unsigned long long calls;
+  unsigned long long cycles;
+};
+
+static void
+add_normalize_stats (hb_buffer_t *,
+		     hb_font_t *,
+		     const hb_buffer_profile_counters_t *counters,
+		     void *user_data)
+{
+  normalize_stats_t *stats = (normalize_stats_t *) user_data;
+  if (counters->stage == HB_BUFFER_PROFILE_STAGE_NORMALIZE)
+  {
+    stats->calls++;
+    stats->cycles += counters->cycles;
+  }
+}
+
+static unsigned int
+split_lines (const char *text, unsigned int len, line_t *lines, unsigned int max_lines)
+{
+  unsigned int count = 0;
+  const char *end = text + len;
+  while (text < end && count < max_lines)
+  {
+    const char *eol = (const char *) memchr (text, '\n', end - text);
+    if (!eol)
+      eol = end;
+    if (eol > text)
+    {
+      lines[count].text = text;
+      lines[count].len = eol - text;
+      count++;
+    }
+    text = eol + 1;
+  }
+  return count;
+}
+
+/* Splits lines further at spaces. */
+static unsigned int
+split_words (const line_t *lines, unsigned int num_lines, line_t *words, unsigned int max_words)
+{
+  unsigned int count = 0;
+  for (unsigned int i = 0; i < num_lines; i++)
+  {
+    const char *text = lines[i].text;
+    const char *end = text + lines[i].len;
+    while (text < end && count < max_words)
+    {
+      const char *space = (const char *) memchr (text, ' ', end - text);
+      if (!space)
+	space = end;
+      if (space > text)
+      {
+	words[count].text = text;
+	words[count].len = space - text;
+	count++;
+      }
+      text = space + 1;
+    }
+  }
+  return count;
+}
+
+/* Shapes each run in a hb_shape() call of its own; returns the number of
+ * glyphs. */
+static unsigned long long
+shape_runs (hb_font_t *font, hb_buffer_t *buffer, const line_t *runs, unsigned int num_runs)
+{
+  unsigned long long glyphs = 0;
+  for (unsigned int j = 0; j < num_runs; j++)
+  {
+    hb_buffer_clear_contents (buffer);
+    hb_buffer_add_utf8 (buffer, runs[j].text, runs[j].len, 0, runs[j].len);
+    hb_buffer_guess_segment_properties (buffer);
+    hb_shape (font, buffer, nullptr, 0);
+    glyphs += hb_buffer_get_length (buffer);
+  }
+  return glyphs;
+}
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 200;
+
+  printf ("{\n  \"benchmark\": \"shape\",\n  \"iterations\": %u,\n  \"results\": [", iterations);
+  for (unsigned int i = 0; i < sizeof (cases) / sizeof (cases[0]); i++)
+  {
+    hb_face_t *face = hb_perf_open_face (cases[i].font);
+    hb_font_t *font = hb_font_create (face);
+    hb_blob_t *blob = hb_perf_open_blob (cases[i].text);
+    hb_buffer_t *buffer = hb_buffer_create ();
+
+    unsigned int len;
+    const char *text = hb_blob_get_data (blob, &len);
+    line_t lines[64];
+    unsigned int num_lines = split_lines (text, len, lines, sizeof (lines) / sizeof (lines[0]));
+
+    /* An untimed pass loads the face tables and the plan, and grows the
+     * buffer; the clock and the allocation counts start after it. */
+    shape_runs (font, buffer, lines, num_lines);
+
+    unsigned long long glyphs = 0;
+    hb_perf_allocation_stats_reset ();
+    double start = hb_perf_now_ns ();
+    for (unsigned int n = 0; n < iterations; n++)
+      glyphs += shape_runs (font, buffer, lines, num_lines);
+    double elapsed = hb_perf_now_ns () - start;
+    unsigned long long calls = (unsigned long long) iterations * num_lines;
+    unsigned long long allocations = hb_perf_allocation_stats.calls;
+
+    unsigned int hits, misses, evictions;
+    hb_shape_plan_cache_get_stats (face, &hits, &misses, &evictions);
+
+    /* The same text split into words, the many short runs
+     * hb_shape_batch() is for: shaped one hb_shape() call per word, then
+     * one hb_shape_batch() call for all of them. */
+    line_t words[1024];
+    unsigned int num_words = split_words (lines, num_lines, words, sizeof (words) / sizeof (words[0]));
+    unsigned long long word_glyphs = 0;
+    double words_start = hb_perf_now_ns ();
+    for (unsigned int n = 0; n < iterations; n++)
+      word_glyphs += shape_runs (font, buffer, words, num_words);
+    double words_elapsed = hb_perf_now_ns () - words_start;
+
+    unsigned int ends[sizeof (words) / sizeof (words[0])];
+    double batch_start = hb_perf_now_ns ();
+    for (unsigned int n = 0; n < iterations; n++)
+    {
+      hb_buffer_clear_contents (buffer);
+      for (unsigned int j = 0; j < num_words; j++)
+      {
+	hb_buffer_add_utf8 (buffer, words[j].text, words[j].len, 0, words[j].len);
+	ends[j] = hb_buffer_get_length (buffer);
+      }
+      hb_buffer_guess_segment_properties (buffer);
+      hb_shape_batch (font, buffer, ends, num_words, nullptr, 0, nullptr);
+    }
+    double batch_elapsed = hb_perf_now_ns () - batch_start;
+
+    /* Once more, profiled, for the normalization stage alone.  Kept apart
+     * as the profiling itself costs time.  Only builds with HB_PROFILE
+     * report anything. */
+    normalize_stats_t normalize = {0, 0};
+    hb_buffer_set_profile_func (buffer, add_normalize_stats, &normalize, nullptr);
+    for (unsigned int n = 0; n < iterations; n++)
+      shape_runs (font, buffer, lines, num_lines);
+
+    printf ("%s\n    {\"name\": \"%s\", \"calls\": %llu, \"glyphs_per_call\": %.1f, "
+	    "\"ns_per_glyph\": %.2f, ",
+	    i ? "," : "",
+	    cases[i].name, calls, (double) glyphs / calls,
+	    elapsed / glyphs);
+    printf ("\"words\": {\"count\": %u, \"glyphs_per_word\": %.1f, "
+	    "\"ns_per_glyph\": %.2f, \"batch_ns_per_glyph\": %.2f}, ",
+	    num_words, (double) word_glyphs / ((unsigned long long) iterations * num_words),
+	    words_elapsed / word_glyphs, batch_elapsed / word_glyphs);
+    if (normalize.calls)
+      printf ("\"normalize_cycles_per_glyph\": %.2f, ", (double) normalize.cycles / glyphs);
+    else
+      printf ("\"normalize_cycles_per_glyph\": null, ");
+    if (hb_perf_have_allocation_stats () && calls)
+      printf ("\"allocations_per_call\": %.2f, ", (double) allocations / calls);
+    else
+      printf ("\"allocations_per_call\": null, ");
+    printf ("\"plan_cache\": {\"hits\": %u, \"misses\": %u, \"evictions\": %u, \"hit_rate\": %.4f}}",
+	    hits, misses, evictions,
+	    hits + misses ? (double) hits / (hits + misses) : 0.);
+
+    hb_buffer_destroy (buffer);
+    hb_blob_destroy (blob);
+    hb_font_destroy (font);
+    hb_face_destroy (face);
+  }
+  printf ("\n  ]\n}\n");
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*
+ * Copyright © 2018  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-subset.hh"
+#include "hb-perf.hh"
+
+/* Times the steps of hb_subset() separately: hb_subset_plan_create(),
+ * then hb_subset_table() for each table of the font, at a few sizes of
+ * the requested codepoint set.  Reports the time and the peak heap
+ * growth of every step, to show which tables dominate.
+ *
+ * The steps are internal, so this program links the libraries
+ * statically. */
+
+static const char *fonts[] =
+{
+  "../test/subset/data/fonts/Roboto-Regular.abc.ttf",
+  "../test/subset/data/fonts/Roboto-Regular.ttf",
+  "../test/subset/data/fonts/Mplus1p-Regular.ttf",
+};
+
+/* Number of codepoints to keep, taken in order from the font's cmap;
+ * zero means all of them. */
+static const unsigned int sizes[] = {10, 100, 1000, 0};
+
+struct step_t
+{
+  hb_tag_t tag;
+  double ns;
+  size_t peak_bytes;
+  unsigned int bytes;
+};
+
+/* Zeroes the allocation counters and returns the bytes in use, to be
+ * subtracted from the peak after the step. */
+static size_t
+step_begin (void)
+{
+  hb_perf_allocation_stats_reset ();
+  return hb_perf_allocation_stats.live_bytes;
+}
+
+static void
+step_end (step_t *step, double start, size_t live)
+{
+  step->ns += hb_perf_now_ns () - start;
+  size_t peak = hb_perf_allocation_stats.peak_bytes - live;
+  if (peak > step->peak_bytes)
+    step->peak_bytes = peak;
+}
+
+static void
+print_step (const step_t *step, unsigned int iterations)
+{
+  printf ("\"ns\": %.0f, ", step->ns / iterations);
+  if (hb_perf_have_allocation_stats ())
+    printf ("\"peak_bytes\": %u", (unsigned int) step->peak_bytes);
+  else
+    printf ("\"peak_bytes\": null");
+}
+
+static void
+bench_subset (hb_face_t *face,
+	      const char *font_path,
+	      const hb_codepoint_t *unicodes,
+	      unsigned int num_unicodes,
+	      unsigned int iterations,
+	      bool first)
+{
+  hb_tag_t tags[64];
+  unsigned int num_tags = sizeof (tags) / sizeof (tags[0]);
+  hb_face_get_table_tags (face, 0, &num_tags, tags);
+
+  step_t plan_step = {0, 0., 0, 0};
+  step_t steps[64];
+  for (unsigned int i = 0; i < num_tags; i++)
+  {
+    steps[i].tag = tags[i];
+    steps[i].ns = 0.;
+    steps[i].peak_bytes = 0;
+    steps[i].bytes = 0;
+  }
+
+  bool dropped[64] = {false};
+  unsigned int num_glyphs = 0;
+  bool success = true;
+  for (unsigned int n = 0; n < iterations; n++)
+  {
+    hb_subset_input_t *input = hb_subset_input_create_or_fail ();
+    hb_set_t *unicode_set = hb_subset_input_unicode_set (input);
+    for (unsigned int i = 0; i < num_unicodes; i++)
+      hb_set_add (unicode_set, unicodes[i]);
+
+    size_t live = step_begin ();
+    double start = hb_perf_now_ns ();
+    hb_subset_plan_t *plan = hb_subset_plan_create (face, input);
+    step_end (&plan_step, start, live);
+    num_glyphs = plan->glyphs.len;
+
+    for (unsigned int i = 0; i < num_tags; i++)
+    {
+      dropped[i] = hb_subset_should_drop_table (plan, tags[i]);
+      if (dropped[i])
+	continue;
+
+      live = step_begin ();
+      start = hb_perf_now_ns ();
+      success = hb_subset_table (plan, tags[i]) && success;
+      step_end (&steps[i], start, live);
+
+      hb_blob_t *blob = hb_face_reference_table (plan->dest, tags[i]);
+      steps[i].bytes = hb_blob_get_length (blob);
+      hb_blob_destroy (blob);
+    }
+
+    hb_subset_plan_destroy (plan);
+    hb_subset_input_destroy (input);
+  }
+
+  double total_ns = plan_step.ns;
+  for (unsigned int i = 0; i < num_tags; i++)
+    total_ns += steps[i].ns;
+
+  const char *font_name = strrchr (font_path, '/');
+  font_name = font_name ? font_name + 1 : font_path;
+  printf ("%s\n    {\"font\": \"%s\", \"codepoints\": %u, \"glyphs\": %u, "
+	  "\"success\": %s, \"total_ns\": %.0f,\n     \"plan\": {",
+	  first ? "" : ",",
+	  font_name, num_unicodes, num_glyphs,
+	  success ? "true" : "false", total_ns / iterations);
+  print_step (&plan_step, iterations);
+  printf ("},\n     \"tables\": [");
+  bool first_table = true;
+  for (unsigned int i = 0; i < num_tags; i++)
+  {
+    if (dropped[i])
+      continue;
+    printf ("%s\n       {\"tag\": \"%c%c%c%c\", \"bytes\": %u, ",
+	    first_table ? "" : ",",
+	    HB_UNTAG (steps[i].tag), steps[i].bytes);
+    print_step (&steps[i], iterations);
+    printf ("}");
+    first_table = false;
+  }
+  printf ("\n     ]}");
+}
+
+int
+main (int argc, char **argv)
+{
+  unsigned int iterations = argc > 1 ? atoi (argv[1]) : 20;
+
+  printf ("{\n  \"benchmark\": \"subset\",\n  \"iterations\": %u,\n  \"results\": [", iterations);
+  bool first = true;
+  for (unsigned int i = 0; i < ARRAY_LENGTH (fonts); i++)
+  {
+    hb_face_t *face = hb_perf_open_face (fonts[i]);
+
+    hb_set_t *font_unicodes = hb_set_create ();
+    hb_face_collect_unicodes (face, font_unicodes);
+    unsigned int total = hb_set_get_population (font_unicodes);
+    hb_codepoint_t *unicodes = (hb_codepoint_t *) calloc (total ? total : 1, sizeof (hb_codepoint_t));
+    hb_codepoint_t u = HB_SET_VALUE_INVALID;
+    for (unsigned int j = 0; hb_set_next (font_unicodes, &u); j++)
+      unicodes[j] = u;
+    hb_set_destroy (font_unicodes);
+
+    for (unsigned int j = 0; j < ARRAY_LENGTH (sizes); j++)
+    {
+      unsigned int size = sizes[j];
+      if (size >= total)
+	continue;
+      bench_subset (face, fonts[i], unicodes, size ? size : total, iterations, first);
+      first = false;
+    }
+
+    free (unicodes);
+    hb_face_destroy (face);
+  }
+  printf ("\n  ]\n}\n");
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+#!/usr/bin/env python
+
+from __future__ import print_function, division, absolute_import
+
+import io, sys
+
+if len (sys.argv) != 2:
+	print ("usage: ./gen-normalization-table.py UnicodeData.txt", file=sys.stderr)
+	sys.exit (1)
+
+# A code point is flagged if canonical normalization can touch it: it has a
+# canonical decomposition, can be the second half of a canonical composition,
+# or has a non-zero combining class.  So decompose(ab) needs ab flagged, and
+# compose(a, b) needs b flagged.  Unassigned code points are flagged too, so
+# that a Unicode implementation newer than this table still gets asked about
+# characters added since; the stability policy keeps the answers for assigned
+# ones from changing.
+
+assigned = set ()
+flagged = set ()
+
+f = io.open (sys.argv[1], encoding='utf-8')
+first = None
+for line in f:
+	fields = line.split (';')
+	if len (fields) < 6:
+		continue
+	u = int (fields[0], 16)
+	name = fields[1]
+
+	if name.endswith (', First>'):
+		first = u
+		continue
+	if name.endswith (', Last>'):
+		assigned.update (range (first, u + 1))
+		first = None
+		continue
+
+	assigned.add (u)
+	if int (fields[3]):
+		flagged.add (u)
+	decomposition = fields[5].split ()
+	if decomposition and not decomposition[0].startswith ('<'):
+		flagged.add (u)
+		if len (decomposition) == 2:
+			flagged.add (int (decomposition[1], 16))
+
+# Hangul is composed and decomposed algorithmically: L + V -> LV, LV + T -> LVT.
+# The T range starts at TBase, U+11A7, as some implementations accept it.
+flagged.update (range (0x1161, 0x1175 + 1))
+flagged.update (range (0x11A7, 0x11C2 + 1))
+flagged.update (range (0xAC00, 0xD7A3 + 1))
+
+flagged.update (u for u in range (0x110000) if u not in assigned)
+
+# Two levels: pages of 128 code points, each pointing to one of the
+# distinct 128-bit blocks.  Only the first three planes are covered; past
+# them is little besides unassigned code points, tags, variation selectors
+# and private use, and the lookup just answers "flagged" for all of it.
+# _hb_unicode_normalization_flagged() in hb-unicode.hh hardcodes these.
+LIMIT = 0x30000
+SHIFT = 7
+
+blocks = []
+block_index = {}
+page_blocks = []
+for page in range (LIMIT >> SHIFT):
+	bits = [0] * ((1 << SHIFT) // 32)
+	for i in range (1 << SHIFT):
+		if (page << SHIFT) + i in flagged:
+			bits[i >> 5] |= 1 << (i & 31)
+	bits = tuple (bits)
+	if bits not in block_index:
+		block_index[bits] = len (blocks)
+		blocks.append (bits)
+	page_blocks.append (block_index[bits])
+
+assert len (blocks) <= 256
+
+
+print ("/* == Start of generated table == */")
+print ("/*")
+print (" * The following tables are generated by running:")
+print (" *")
+print (" *   ./gen-normalization-table.py UnicodeData.txt")
+print (" *")
+print (" * UnicodeData.txt does not have a header.")
+print (" */")
+print ()
+print ("#ifndef HB_UNICODE_NORMALIZATION_TABLE_HH")
+print ("#define HB_UNICODE_NORMALIZATION_TABLE_HH")
+print ()
+print ('#include "hb-unicode.hh"')
+print ()
+print ()
+print ("const uint8_t _hb_unicode_normalization_pages[%d] =" % len (page_blocks))
+print ("{")
+for i in range (0, len (page_blocks), 16):
+	print ("  %s, /* U+%04X */" % (",".join ("%3d" % b for b in page_blocks[i:i + 16]), i << SHIFT))
+print ("};")
+print ()
+print ("const uint32_t _hb_unicode_normalization_blocks[%d][%d] =" % (len (blocks), len (blocks[0])))
+print ("{")
+for bits in blocks:
+	print ("  {%s}," % ", ".join ("0x%08Xu" % w for w in bits))
+print ("};")
+print ()
+print ("#endif /* HB_UNICODE_NORMALIZATION_TABLE_HH */")
+print ()
+print ("/* == End of generated table == */")
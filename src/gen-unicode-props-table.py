@@ -0,0 +1,127 @@
+#!/usr/bin/env python
+
+from __future__ import print_function, division, absolute_import
+
+import io, sys
+
+if len (sys.argv) != 3:
+	print ("usage: ./gen-unicode-props-table.py UnicodeData.txt DerivedCoreProperties.txt", file=sys.stderr)
+	sys.exit (1)
+
+# Each code point gets one packed record: general category in bits 0..4,
+# Default_Ignorable in bit 5, canonical combining class in bits 8..15.  The
+# general category values are those of hb_unicode_general_category_t.
+
+categories = ['Cc', 'Cf', 'Cn', 'Co', 'Cs', 'Ll', 'Lm', 'Lo', 'Lt', 'Lu',
+	      'Mc', 'Me', 'Mn', 'Nd', 'Nl', 'No', 'Pc', 'Pd', 'Pe', 'Pf',
+	      'Pi', 'Po', 'Ps', 'Sc', 'Sk', 'Sm', 'So', 'Zl', 'Zp', 'Zs']
+UNASSIGNED = categories.index ('Cn')
+IGNORABLE = 0x20
+
+props = [UNASSIGNED] * 0x110000
+
+f = io.open (sys.argv[1], encoding='utf-8')
+first = None
+for line in f:
+	fields = line.split (';')
+	if len (fields) < 4:
+		continue
+	u = int (fields[0], 16)
+	name = fields[1]
+	record = categories.index (fields[2]) | (int (fields[3]) << 8)
+
+	if name.endswith (', First>'):
+		first = u
+		continue
+	if name.endswith (', Last>'):
+		for v in range (first, u + 1):
+			props[v] = record
+		first = None
+		continue
+
+	props[u] = record
+
+# While U+115F, U+1160, U+3164 and U+FFA0 are Default_Ignorable, they are
+# implemented as regular spacing glyphs; same for U+1BCA0..1BCA3.  See
+# is_default_ignorable() in hb-unicode.hh.
+not_ignorable = set ([0x115F, 0x1160, 0x3164, 0xFFA0] + list (range (0x1BCA0, 0x1BCA3 + 1)))
+
+f = io.open (sys.argv[2], encoding='utf-8')
+for line in f:
+	line = line.split ('#')[0].strip ()
+	if not line:
+		continue
+	rang, prop = [s.strip () for s in line.split (';')]
+	if prop != 'Default_Ignorable_Code_Point':
+		continue
+	rang = [int (s, 16) for s in rang.split ('..')]
+	for u in range (rang[0], rang[-1] + 1):
+		if u not in not_ignorable:
+			props[u] |= IGNORABLE
+
+# Two stages: pages of 128 code points, each pointing to one of the distinct
+# blocks, which hold indices into the list of distinct records.  Record 0
+# is that of unassigned code points, which the lookup also uses past
+# U+10FFFF.  _hb_unicode_props() in hb-unicode.hh hardcodes these.
+SHIFT = 7
+
+records = [UNASSIGNED]
+record_index = {UNASSIGNED: 0}
+for record in props:
+	if record not in record_index:
+		record_index[record] = len (records)
+		records.append (record)
+
+blocks = []
+block_index = {}
+page_blocks = []
+for page in range (0x110000 >> SHIFT):
+	block = tuple (record_index[record] for record in props[page << SHIFT:(page + 1) << SHIFT])
+	if block not in block_index:
+		block_index[block] = len (blocks)
+		blocks.append (block)
+	page_blocks.append (block_index[block])
+
+assert len (records) <= 256
+assert len (blocks) <= 256
+
+
+print ("/* == Start of generated table == */")
+print ("/*")
+print (" * The following tables are generated by running:")
+print (" *")
+print (" *   ./gen-unicode-props-table.py UnicodeData.txt DerivedCoreProperties.txt")
+print (" *")
+print (" * UnicodeData.txt does not have a header.")
+print (" */")
+print ()
+print ("#ifndef HB_UNICODE_PROPS_TABLE_HH")
+print ("#define HB_UNICODE_PROPS_TABLE_HH")
+print ()
+print ('#include "hb-unicode.hh"')
+print ()
+print ()
+print ("const uint8_t _hb_unicode_props_pages[%d] =" % len (page_blocks))
+print ("{")
+for i in range (0, len (page_blocks), 16):
+	print ("  %s, /* U+%04X */" % (",".join ("%3d" % b for b in page_blocks[i:i + 16]), i << SHIFT))
+print ("};")
+print ()
+print ("const uint8_t _hb_unicode_props_blocks[%d][%d] =" % (len (blocks), 1 << SHIFT))
+print ("{")
+for i, block in enumerate (blocks):
+	print ("  { /* %d */" % i)
+	for j in range (0, len (block), 16):
+		print ("    %s," % ",".join ("%3d" % r for r in block[j:j + 16]))
+	print ("  },")
+print ("};")
+print ()
+print ("const uint16_t _hb_unicode_props_records[%d] =" % len (records))
+print ("{")
+for i in range (0, len (records), 8):
+	print ("  %s," % ", ".join ("0x%04Xu" % r for r in records[i:i + 8]))
+print ("};")
+print ()
+print ("#endif /* HB_UNICODE_PROPS_TABLE_HH */")
+print ()
+print ("/* == End of generated table == */")
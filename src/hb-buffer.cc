@@ -108,6 +108,81 @@ hb_segment_properties_hash (const hb_segment_properties_t *p)
 
 /* Internal API */
 
+bool
+hb_buffer_pool_t::take (storage_t *storage)
+{
+  hb_lock_t l (lock);
+
+  held++;
+  high_water = MAX (high_water, held);
+
+  if (!cached.len)
+    return false;
+
+  /* Most recently given back is the likeliest to still be in cache. */
+  *storage = cached[cached.len - 1];
+  cached.pop ();
+  return true;
+}
+
+void
+hb_buffer_pool_t::hold (void)
+{
+  hb_lock_t l (lock);
+
+  held++;
+  high_water = MAX (high_water, held);
+}
+
+void
+hb_buffer_pool_t::give (const storage_t &storage)
+{
+  bool cached_it;
+  {
+    hb_lock_t l (lock);
+    cached_it = cached.resize (cached.len + 1);
+    if (likely (cached_it))
+      cached[cached.len - 1] = storage;
+  }
+
+  if (unlikely (!cached_it))
+  {
+    storage_t s = storage;
+    s.fini ();
+  }
+}
+
+void
+hb_buffer_pool_t::drop (void)
+{
+  hb_lock_t l (lock);
+
+  held--;
+}
+
+void
+hb_buffer_pool_t::trim (void)
+{
+  hb_lock_t l (lock);
+
+  /* Keep enough for the most buffers that were out at once to come back
+   * and leave again; free the oldest of the rest. */
+  unsigned int keep = high_water > held ? high_water - held : 0;
+  if (cached.len > keep)
+  {
+    unsigned int count = cached.len - keep;
+    storage_t *array = cached.arrayZ ();
+    for (unsigned int i = 0; i < count; i++)
+      array[i].fini ();
+    memmove (static_cast<void *> (array),
+	     static_cast<void *> (array + count),
+	     keep * sizeof (array[0]));
+    cached.shrink (keep);
+  }
+
+  high_water = held;
+}
+
 bool
 hb_buffer_t::enlarge (unsigned int size)
 {
@@ -119,6 +194,13 @@ hb_buffer_t::enlarge (unsigned int size)
     return false;
   }
 
+  if (unlikely (pool && !pool_held))
+  {
+    hold_pool_storage ();
+    if (size < allocated)
+      return true;
+  }
+
   unsigned int new_allocated = allocated;
   hb_glyph_position_t *new_pos = nullptr;
   hb_glyph_info_t *new_info = nullptr;
@@ -134,8 +216,30 @@ hb_buffer_t::enlarge (unsigned int size)
   if (unlikely (hb_unsigned_mul_overflows (new_allocated, sizeof (info[0]))))
     goto done;
 
-  new_pos = (hb_glyph_position_t *) realloc (pos, new_allocated * sizeof (pos[0]));
-  new_info = (hb_glyph_info_t *) realloc (info, new_allocated * sizeof (info[0]));
+  if (unlikely (in_arena))
+  {
+    /* Outgrew the caller's arena; move to memory of our own. */
+    new_pos = (hb_glyph_position_t *) malloc (new_allocated * sizeof (pos[0]));
+    new_info = (hb_glyph_info_t *) malloc (new_allocated * sizeof (info[0]));
+    if (likely (new_pos && new_info))
+    {
+      memcpy (new_pos, pos, allocated * sizeof (pos[0]));
+      memcpy (new_info, info, allocated * sizeof (info[0]));
+      in_arena = false;
+    }
+    else
+    {
+      free (new_pos);
+      free (new_info);
+      new_pos = nullptr;
+      new_info = nullptr;
+    }
+  }
+  else
+  {
+    new_pos = (hb_glyph_position_t *) realloc (pos, new_allocated * sizeof (pos[0]));
+    new_info = (hb_glyph_info_t *) realloc (info, new_allocated * sizeof (info[0]));
+  }
 
 done:
   if (unlikely (!new_pos || !new_info))
@@ -154,6 +258,87 @@ done:
   return likely (successful);
 }
 
+void *
+hb_buffer_t::get_scratch_slow (unsigned int size)
+{
+  if (unlikely (hb_object_is_inert (this)))
+    return nullptr;
+
+  if (unlikely (pool && !pool_held))
+  {
+    hold_pool_storage ();
+    if (size <= scratch_size)
+      return scratch;
+  }
+
+  void *new_scratch = realloc (scratch, size);
+  if (unlikely (!new_scratch))
+    return nullptr;
+
+  scratch = new_scratch;
+  scratch_size = size;
+  return scratch;
+}
+
+bool
+hb_buffer_t::holds_storage (void) const
+{
+  return (!in_arena && (info || pos)) || scratch;
+}
+
+/* Called the first time the buffer needs memory after being given a pool;
+ * picks up storage the pool has cached if the buffer has none yet. */
+void
+hb_buffer_t::hold_pool_storage (void)
+{
+  pool_held = true;
+
+  if (holds_storage () || in_arena)
+  {
+    pool->hold ();
+    return;
+  }
+
+  hb_buffer_pool_t::storage_t storage;
+  if (pool->take (&storage))
+  {
+    info = out_info = storage.info;
+    pos = storage.pos;
+    allocated = storage.allocated;
+    scratch = storage.scratch;
+    scratch_size = storage.scratch_size;
+  }
+}
+
+void
+hb_buffer_t::release_storage (void)
+{
+  hb_buffer_pool_t::storage_t storage = {
+    in_arena ? nullptr : info,
+    in_arena ? nullptr : pos,
+    in_arena ? 0 : allocated,
+    scratch,
+    scratch_size
+  };
+
+  if (pool_held)
+  {
+    if (storage.info || storage.pos || storage.scratch)
+      pool->give (storage);
+    pool->drop ();
+    pool_held = false;
+  }
+  else
+    storage.fini ();
+
+  info = out_info = nullptr;
+  pos = nullptr;
+  allocated = 0;
+  in_arena = false;
+  scratch = nullptr;
+  scratch_size = 0;
+}
+
 bool
 hb_buffer_t::make_room_for (unsigned int num_in,
 			    unsigned int num_out)
@@ -419,6 +604,7 @@ hb_buffer_t::move_to (unsigned int i)
     idx -= count;
     out_len -= count;
     memmove (info + idx, out_info + out_len, count * sizeof (out_info[0]));
+    rewinds++;
   }
 
   return true;
@@ -642,13 +828,21 @@ hb_buffer_t::guess_segment_properties (void)
 
   /* If script is set to INVALID, guess from buffer contents */
   if (props.script == HB_SCRIPT_INVALID) {
-    for (unsigned int i = 0; i < len; i++) {
-      hb_script_t script = unicode->script (info[i].codepoint);
-      if (likely (script != HB_SCRIPT_COMMON &&
-		  script != HB_SCRIPT_INHERITED &&
-		  script != HB_SCRIPT_UNKNOWN)) {
-        props.script = script;
-        break;
+    /* Small chunks, as the first character usually decides. */
+    hb_script_t scripts[8];
+    for (unsigned int start = 0; start < len && props.script == HB_SCRIPT_INVALID; start += ARRAY_LENGTH (scripts)) {
+      unsigned int count = MIN (len - start, (unsigned int) ARRAY_LENGTH (scripts));
+      unicode->scripts (count,
+			&info[start].codepoint, sizeof (info[0]),
+			scripts, sizeof (scripts[0]));
+      for (unsigned int i = 0; i < count; i++) {
+	hb_script_t script = scripts[i];
+	if (likely (script != HB_SCRIPT_COMMON &&
+		    script != HB_SCRIPT_INHERITED &&
+		    script != HB_SCRIPT_UNKNOWN)) {
+	  props.script = script;
+	  break;
+	}
       }
     }
   }
@@ -687,9 +881,42 @@ DEFINE_NULL_INSTANCE (hb_buffer_t) =
   HB_SEGMENT_PROPERTIES_DEFAULT,
   false, /* successful */
   true, /* have_output */
-  true  /* have_positions */
-
-  /* Zero is good enough for everything else. */
+  true, /* have_positions */
+
+  0, /* idx */
+  0, /* len */
+  0, /* out_len */
+  0, /* rewinds */
+
+  0, /* allocated */
+  nullptr, /* info */
+  nullptr, /* out_info */
+  nullptr, /* pos */
+  false, /* in_arena */
+
+  nullptr, /* scratch */
+  0, /* scratch_size */
+
+  nullptr, /* pool */
+  false, /* pool_held */
+
+  0, /* serial */
+
+  {{0}}, /* context */
+  {0}, /* context_len */
+
+  nullptr, /* message_func */
+  nullptr, /* message_data */
+  nullptr, /* message_destroy */
+  nullptr, /* profile_func */
+  nullptr, /* profile_data */
+  nullptr, /* profile_destroy */
+  0, /* profile_lookups_run */
+  0, /* profile_lookups_skipped */
+
+#ifndef HB_NDEBUG
+  0, /* allocated_var_bits */
+#endif
 };
 
 
@@ -773,10 +1000,13 @@ hb_buffer_destroy (hb_buffer_t *buffer)
 
   hb_unicode_funcs_destroy (buffer->unicode);
 
-  free (buffer->info);
-  free (buffer->pos);
+  buffer->release_storage ();
+  hb_buffer_pool_destroy (buffer->pool);
+
   if (buffer->message_destroy)
     buffer->message_destroy (buffer->message_data);
+  if (buffer->profile_destroy)
+    buffer->profile_destroy (buffer->profile_data);
 
   free (buffer);
 }
@@ -1285,6 +1515,205 @@ hb_buffer_allocation_successful (hb_buffer_t  *buffer)
   return buffer->successful;
 }
 
+
+/**
+ * hb_buffer_pool_create: (Xconstructor)
+ *
+ * Creates a new, empty #hb_buffer_pool_t.  Buffers attached to it with
+ * hb_buffer_set_pool() give their memory back to it when destroyed, and
+ * pick memory up from it instead of allocating when they first need some.
+ * A pool can be shared between threads.
+ *
+ * Return value: (transfer full):
+ * A newly allocated #hb_buffer_pool_t with a reference count of 1.  Release
+ * it with hb_buffer_pool_destroy() when done.
+ *
+ * Since: REPLACEME
+ **/
+hb_buffer_pool_t *
+hb_buffer_pool_create (void)
+{
+  hb_buffer_pool_t *pool;
+
+  if (!(pool = hb_object_create<hb_buffer_pool_t> ()))
+    return const_cast<hb_buffer_pool_t *> (&Null(hb_buffer_pool_t));
+
+  pool->init ();
+
+  return pool;
+}
+
+/**
+ * hb_buffer_pool_reference: (skip)
+ * @pool: an #hb_buffer_pool_t.
+ *
+ * Increases the reference count on @pool by one.
+ *
+ * Return value: (transfer full):
+ * The referenced #hb_buffer_pool_t.
+ *
+ * Since: REPLACEME
+ **/
+hb_buffer_pool_t *
+hb_buffer_pool_reference (hb_buffer_pool_t *pool)
+{
+  return hb_object_reference (pool);
+}
+
+/**
+ * hb_buffer_pool_destroy: (skip)
+ * @pool: an #hb_buffer_pool_t.
+ *
+ * Decreases the reference count on @pool by one.  If the result is zero,
+ * the memory cached in @pool is freed along with it.  Buffers attached to
+ * @pool hold a reference to it.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_buffer_pool_destroy (hb_buffer_pool_t *pool)
+{
+  if (!hb_object_destroy (pool)) return;
+
+  pool->fini ();
+
+  free (pool);
+}
+
+/**
+ * hb_buffer_pool_trim:
+ * @pool: an #hb_buffer_pool_t.
+ *
+ * Frees the memory cached in @pool beyond what the most buffers attached to
+ * it at once since the last trim would need, and starts counting afresh.
+ * Calling this periodically lets the pool shrink back after a burst.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_buffer_pool_trim (hb_buffer_pool_t *pool)
+{
+  if (unlikely (hb_object_is_inert (pool)))
+    return;
+
+  pool->trim ();
+}
+
+/**
+ * hb_buffer_set_pool:
+ * @buffer: an #hb_buffer_t.
+ * @pool: (nullable): an #hb_buffer_pool_t, or %NULL.
+ *
+ * Attaches @buffer to @pool: from then on, @buffer takes its memory from
+ * @pool when it first needs some, and gives it back to @pool when
+ * destroyed.  The pool stays attached across hb_buffer_reset() and
+ * hb_buffer_clear_contents().  Passing %NULL detaches @buffer.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_buffer_set_pool (hb_buffer_t      *buffer,
+		    hb_buffer_pool_t *pool)
+{
+  if (unlikely (hb_object_is_inert (buffer)))
+    return;
+
+  if (pool && hb_object_is_inert (pool))
+    pool = nullptr;
+
+  if (buffer->pool_held)
+    buffer->pool->drop ();
+  buffer->pool_held = false;
+
+  hb_buffer_pool_reference (pool);
+  hb_buffer_pool_destroy (buffer->pool);
+  buffer->pool = pool;
+
+  if (pool && buffer->holds_storage ())
+  {
+    pool->hold ();
+    buffer->pool_held = true;
+  }
+}
+
+/**
+ * hb_buffer_get_pool:
+ * @buffer: an #hb_buffer_t.
+ *
+ * Fetches the pool @buffer is attached to.
+ *
+ * Return value: (transfer none):
+ * The #hb_buffer_pool_t set with hb_buffer_set_pool(), or %NULL.
+ *
+ * Since: REPLACEME
+ **/
+hb_buffer_pool_t *
+hb_buffer_get_pool (hb_buffer_t *buffer)
+{
+  return buffer->pool;
+}
+
+/**
+ * hb_buffer_set_arena:
+ * @buffer: an #hb_buffer_t.
+ * @arena: (nullable): memory for @buffer to keep its glyphs in, or %NULL.
+ * @size: the size of @arena in bytes.
+ *
+ * Makes @buffer keep its glyph information and positions in @arena, which
+ * the caller owns and must keep alive for as long as @buffer uses it.
+ * Memory @buffer had allocated for them is freed, or given back to its
+ * pool.  If the contents outgrow @arena, @buffer moves them to memory of
+ * its own and stops using @arena.  Passing %NULL stops using an arena.
+ *
+ * @buffer must be empty.
+ *
+ * Return value:
+ * %true if @buffer now uses @arena, %false if @buffer is not empty or
+ * @arena is too small to hold a single glyph.
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_buffer_set_arena (hb_buffer_t  *buffer,
+		     void         *arena,
+		     unsigned int  size)
+{
+  if (unlikely (hb_object_is_inert (buffer) || buffer->len || buffer->out_len))
+    return false;
+
+  const unsigned int align = alignof (hb_glyph_info_t);
+  unsigned int skip = (align - (uintptr_t) arena % align) % align;
+  unsigned int count = size > skip ? (size - skip) / (sizeof (hb_glyph_info_t) + sizeof (hb_glyph_position_t)) : 0;
+  if (arena && !count)
+    return false;
+
+  if (!buffer->in_arena && (buffer->info || buffer->pos))
+  {
+    hb_buffer_pool_t::storage_t storage = {buffer->info, buffer->pos, buffer->allocated, nullptr, 0};
+    if (buffer->pool_held)
+      buffer->pool->give (storage);
+    else
+      storage.fini ();
+  }
+
+  if (arena)
+  {
+    buffer->info = (hb_glyph_info_t *) ((char *) arena + skip);
+    buffer->pos = (hb_glyph_position_t *) (buffer->info + count);
+    buffer->allocated = count;
+  }
+  else
+  {
+    buffer->info = nullptr;
+    buffer->pos = nullptr;
+    buffer->allocated = 0;
+  }
+  buffer->out_info = buffer->info;
+  buffer->in_arena = arena != nullptr;
+
+  return true;
+}
+
 /**
  * hb_buffer_add:
  * @buffer: an #hb_buffer_t.
@@ -1570,10 +1999,45 @@ hb_buffer_add_utf (hb_buffer_t  *buffer,
   const T *end = next + item_length;
   while (next < end)
   {
-    hb_codepoint_t u;
-    const T *old_next = next;
-    next = utf_t::next (next, end, &u, replacement);
-    buffer->add (u, old_next - (const T *) text);
+    /* Decode a chunk at a time straight into the buffer.  Each code unit
+     * makes at most one glyph, so room for the chunk length is enough,
+     * even if the last sequence runs past the chunk. */
+    const T *chunk_end = next + MIN (end - next, (ptrdiff_t) 256);
+    if (unlikely (!buffer->ensure (buffer->len + (chunk_end - next))))
+    {
+      next = end;
+      break;
+    }
+
+    hb_glyph_info_t *info = buffer->info + buffer->len;
+    while (next < chunk_end)
+    {
+      /* Runs of code units that are code points by themselves, like
+       * ASCII in UTF-8, need no decoding. */
+      unsigned int count = utf_t::simple_run (next, chunk_end);
+      unsigned int cluster = next - text;
+      for (unsigned int i = 0; i < count; i++)
+      {
+	info->codepoint = next[i];
+	info->mask = 0;
+	info->cluster = cluster + i;
+	info->var1.u32 = info->var2.u32 = 0;
+	info++;
+      }
+      next += count;
+      if (next >= chunk_end)
+	break;
+
+      hb_codepoint_t u;
+      const T *old_next = next;
+      next = utf_t::next (next, end, &u, replacement);
+      info->codepoint = u;
+      info->mask = 0;
+      info->cluster = old_next - text;
+      info->var1.u32 = info->var2.u32 = 0;
+      info++;
+    }
+    buffer->len = info - buffer->info;
   }
 
   /* Add post-context */
@@ -2029,3 +2493,64 @@ hb_buffer_t::message_impl (hb_font_t *font, const char *fmt, va_list ap)
   vsnprintf (buf, sizeof (buf),  fmt, ap);
   return (bool) this->message_func (this, font, buf, this->message_data);
 }
+
+/**
+ * hb_buffer_set_profile_func:
+ * @buffer: an #hb_buffer_t.
+ * @func: (closure user_data) (destroy destroy) (scope notified):
+ * @user_data:
+ * @destroy:
+ *
+ * Sets a function to be called after each stage of shaping @buffer, and
+ * after each GSUB and GPOS lookup applied, with the time it took and the
+ * buffer length before and after.  The substitution and positioning
+ * stages also report how many lookups were run and how many were
+ * skipped; skipped lookups are not reported on their own.
+ *
+ * Profiling has to be enabled when HarfBuzz is built, by defining
+ * HB_PROFILE to 1; otherwise @func is never called and shaping does not
+ * pay for the checks.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_buffer_set_profile_func (hb_buffer_t *buffer,
+			    hb_buffer_profile_func_t func,
+			    void *user_data, hb_destroy_func_t destroy)
+{
+  if (unlikely (hb_object_is_inert (buffer)))
+  {
+    if (destroy)
+      destroy (user_data);
+    return;
+  }
+
+  if (buffer->profile_destroy)
+    buffer->profile_destroy (buffer->profile_data);
+
+  if (func) {
+    buffer->profile_func = func;
+    buffer->profile_data = user_data;
+    buffer->profile_destroy = destroy;
+  } else {
+    buffer->profile_func = nullptr;
+    buffer->profile_data = nullptr;
+    buffer->profile_destroy = nullptr;
+  }
+}
+
+void
+hb_buffer_t::profile_impl (hb_font_t *font,
+			   hb_buffer_profile_stage_t stage,
+			   hb_tag_t table_tag,
+			   unsigned int lookup_index,
+			   uint64_t cycles,
+			   unsigned int glyphs_in,
+			   unsigned int lookups_run,
+			   unsigned int lookups_skipped)
+{
+  hb_buffer_profile_counters_t counters = {stage, table_tag, lookup_index,
+					   cycles, glyphs_in, len,
+					   lookups_run, lookups_skipped};
+  this->profile_func (this, font, &counters, this->profile_data);
+}
@@ -363,6 +363,41 @@ hb_buffer_pre_allocate (hb_buffer_t  *buffer,
 HB_EXTERN hb_bool_t
 hb_buffer_allocation_successful (hb_buffer_t  *buffer);
 
+
+/**
+ * hb_buffer_pool_t:
+ *
+ * Memory that buffers give back when destroyed, for new buffers to pick
+ * up instead of allocating their own.  See hb_buffer_set_pool().
+ *
+ * Since: REPLACEME
+ */
+typedef struct hb_buffer_pool_t hb_buffer_pool_t;
+
+HB_EXTERN hb_buffer_pool_t *
+hb_buffer_pool_create (void);
+
+HB_EXTERN hb_buffer_pool_t *
+hb_buffer_pool_reference (hb_buffer_pool_t *pool);
+
+HB_EXTERN void
+hb_buffer_pool_destroy (hb_buffer_pool_t *pool);
+
+HB_EXTERN void
+hb_buffer_pool_trim (hb_buffer_pool_t *pool);
+
+HB_EXTERN void
+hb_buffer_set_pool (hb_buffer_t      *buffer,
+		    hb_buffer_pool_t *pool);
+
+HB_EXTERN hb_buffer_pool_t *
+hb_buffer_get_pool (hb_buffer_t *buffer);
+
+HB_EXTERN hb_bool_t
+hb_buffer_set_arena (hb_buffer_t  *buffer,
+		     void         *arena,
+		     unsigned int  size);
+
 HB_EXTERN void
 hb_buffer_reverse (hb_buffer_t *buffer);
 
@@ -572,6 +607,74 @@ hb_buffer_set_message_func (hb_buffer_t *buffer,
 			    hb_buffer_message_func_t func,
 			    void *user_data, hb_destroy_func_t destroy);
 
+/**
+ * hb_buffer_profile_stage_t:
+ * @HB_BUFFER_PROFILE_STAGE_NORMALIZE: Unicode normalization and cmap lookup.
+ * @HB_BUFFER_PROFILE_STAGE_SETUP_MASKS: feature mask setup.
+ * @HB_BUFFER_PROFILE_STAGE_SUBSTITUTE: glyph substitution (GSUB or morx).
+ * @HB_BUFFER_PROFILE_STAGE_POSITION: glyph positioning (GPOS or kerx).
+ * @HB_BUFFER_PROFILE_STAGE_KERN: kerning from the kern table.
+ * @HB_BUFFER_PROFILE_STAGE_FALLBACK: fallback mark positioning and kerning.
+ * @HB_BUFFER_PROFILE_STAGE_HIDE_DEFAULT_IGNORABLES: hiding or removing
+ *   default-ignorable characters.
+ * @HB_BUFFER_PROFILE_STAGE_LOOKUP: a single GSUB or GPOS lookup, reported
+ *   while inside the substitute or position stage.
+ *
+ * The parts of shaping that hb_buffer_set_profile_func() reports on.
+ *
+ * Since: REPLACEME
+ */
+typedef enum {
+  HB_BUFFER_PROFILE_STAGE_NORMALIZE,
+  HB_BUFFER_PROFILE_STAGE_SETUP_MASKS,
+  HB_BUFFER_PROFILE_STAGE_SUBSTITUTE,
+  HB_BUFFER_PROFILE_STAGE_POSITION,
+  HB_BUFFER_PROFILE_STAGE_KERN,
+  HB_BUFFER_PROFILE_STAGE_FALLBACK,
+  HB_BUFFER_PROFILE_STAGE_HIDE_DEFAULT_IGNORABLES,
+  HB_BUFFER_PROFILE_STAGE_LOOKUP
+} hb_buffer_profile_stage_t;
+
+/**
+ * hb_buffer_profile_counters_t:
+ * @stage: the stage that ran.
+ * @table_tag: for %HB_BUFFER_PROFILE_STAGE_LOOKUP, the tag of the table
+ *   the lookup belongs to; zero otherwise.
+ * @lookup_index: for %HB_BUFFER_PROFILE_STAGE_LOOKUP, the index of the
+ *   lookup; zero otherwise.
+ * @cycles: time spent in the stage, in CPU timestamp-counter cycles on x86
+ *   and in nanoseconds elsewhere.
+ * @glyphs_in: the buffer length when the stage started.
+ * @glyphs_out: the buffer length when the stage finished.
+ * @lookups_run: the number of GSUB or GPOS lookups run during the stage.
+ * @lookups_skipped: the number of GSUB or GPOS lookups skipped during the
+ *   stage without being run, as no glyph in the buffer could match them.
+ *
+ * What hb_buffer_set_profile_func() reports for each stage.
+ *
+ * Since: REPLACEME
+ */
+typedef struct hb_buffer_profile_counters_t {
+  hb_buffer_profile_stage_t stage;
+  hb_tag_t                  table_tag;
+  unsigned int              lookup_index;
+  uint64_t                  cycles;
+  unsigned int              glyphs_in;
+  unsigned int              glyphs_out;
+  unsigned int              lookups_run;
+  unsigned int              lookups_skipped;
+} hb_buffer_profile_counters_t;
+
+typedef void		(*hb_buffer_profile_func_t)	(hb_buffer_t *buffer,
+							 hb_font_t   *font,
+							 const hb_buffer_profile_counters_t *counters,
+							 void        *user_data);
+
+HB_EXTERN void
+hb_buffer_set_profile_func (hb_buffer_t *buffer,
+			    hb_buffer_profile_func_t func,
+			    void *user_data, hb_destroy_func_t destroy);
+
 
 HB_END_DECLS
 
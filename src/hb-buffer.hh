@@ -54,6 +54,12 @@
 #define HB_BUFFER_MAX_OPS_DEFAULT 0x1FFFFFFF /* Shaping more than a billion operations? Let us know! */
 #endif
 
+/* Define to 1 to make hb_buffer_set_profile_func() work.  Off by default,
+ * so the checks cost nothing. */
+#ifndef HB_PROFILE
+#define HB_PROFILE 0
+#endif
+
 static_assert ((sizeof (hb_glyph_info_t) == 20), "");
 static_assert ((sizeof (hb_glyph_info_t) == sizeof (hb_glyph_position_t)), "");
 
@@ -79,6 +85,60 @@ enum hb_buffer_scratch_flags_t {
 HB_MARK_AS_FLAG_T (hb_buffer_scratch_flags_t);
 
 
+/*
+ * hb_buffer_pool_t
+ */
+
+struct hb_buffer_pool_t
+{
+  hb_object_header_t header;
+  ASSERT_POD ();
+
+  /* What a buffer allocates for itself. */
+  struct storage_t
+  {
+    hb_glyph_info_t *info;
+    hb_glyph_position_t *pos;
+    unsigned int allocated;
+    void *scratch;
+    unsigned int scratch_size;
+
+    inline void fini (void)
+    {
+      free (info);
+      free (pos);
+      free (scratch);
+    }
+  };
+
+  hb_mutex_t lock;
+  hb_vector_t<storage_t, 4> cached;
+  unsigned int held; /* Buffers holding storage they will give back. */
+  unsigned int high_water; /* Most held at once since the last trim. */
+
+  inline void init (void)
+  {
+    lock.init ();
+    cached.init ();
+    held = high_water = 0;
+  }
+
+  inline void fini (void)
+  {
+    for (unsigned int i = 0; i < cached.len; i++)
+      cached[i].fini ();
+    cached.fini ();
+    lock.fini ();
+  }
+
+  HB_INTERNAL bool take (storage_t *storage);
+  HB_INTERNAL void hold (void);
+  HB_INTERNAL void give (const storage_t &storage);
+  HB_INTERNAL void drop (void);
+  HB_INTERNAL void trim (void);
+};
+
+
 /*
  * hb_buffer_t
  */
@@ -109,11 +169,21 @@ struct hb_buffer_t
   unsigned int idx; /* Cursor into ->info and ->pos arrays */
   unsigned int len; /* Length of ->info and ->pos arrays */
   unsigned int out_len; /* Length of ->out array if have_output */
+  unsigned int rewinds; /* Times move_to() moved glyphs back to ->info,
+			 * renumbering those from idx on. */
 
   unsigned int allocated; /* Length of allocated arrays */
   hb_glyph_info_t     *info;
   hb_glyph_info_t     *out_info;
   hb_glyph_position_t *pos;
+  bool in_arena; /* Whether info and pos are in memory the caller owns */
+
+  /* Memory shaping stages can borrow; see get_scratch(). */
+  void *scratch;
+  unsigned int scratch_size;
+
+  hb_buffer_pool_t *pool;
+  bool pool_held; /* Whether pool counts what this buffer holds as its. */
 
   unsigned int serial;
 
@@ -128,6 +198,11 @@ struct hb_buffer_t
   hb_buffer_message_func_t message_func;
   void *message_data;
   hb_destroy_func_t message_destroy;
+  hb_buffer_profile_func_t profile_func;
+  void *profile_data;
+  hb_destroy_func_t profile_destroy;
+  unsigned int profile_lookups_run; /* Only counted while profiling. */
+  unsigned int profile_lookups_skipped;
 
   /* Internal debugging. */
   /* The bits here reflect current allocations of the bytes in glyph_info_t's var1 and var2. */
@@ -334,6 +409,15 @@ struct hb_buffer_t
   HB_INTERNAL bool move_to (unsigned int i); /* i is output-buffer index. */
 
   HB_INTERNAL bool enlarge (unsigned int size);
+  HB_INTERNAL void *get_scratch_slow (unsigned int size);
+  HB_INTERNAL bool holds_storage (void) const;
+  HB_INTERNAL void hold_pool_storage (void);
+  HB_INTERNAL void release_storage (void);
+
+  /* Returns size bytes of memory that stay with the buffer across shaping
+   * calls, for one user at a time, or nullptr. */
+  inline void *get_scratch (unsigned int size)
+  { return likely (size <= scratch_size) ? scratch : get_scratch_slow (size); }
 
   inline bool ensure (unsigned int size)
   { return likely (!size || size < allocated) ? true : enlarge (size); }
@@ -364,6 +448,16 @@ struct hb_buffer_t
   }
   HB_INTERNAL bool message_impl (hb_font_t *font, const char *fmt, va_list ap) HB_PRINTF_FUNC(3, 0);
 
+  inline bool profiling (void) const { return HB_PROFILE && unlikely (profile_func); }
+  HB_INTERNAL void profile_impl (hb_font_t *font,
+				 hb_buffer_profile_stage_t stage,
+				 hb_tag_t table_tag,
+				 unsigned int lookup_index,
+				 uint64_t cycles,
+				 unsigned int glyphs_in,
+				 unsigned int lookups_run,
+				 unsigned int lookups_skipped);
+
   static inline void
   set_cluster (hb_glyph_info_t &inf, unsigned int cluster, unsigned int mask = 0)
   {
@@ -444,4 +538,82 @@ _next_cluster (hb_buffer_t *buffer, unsigned int start)
 #define HB_BUFFER_ASSERT_VAR(b, var)		HB_BUFFER_XALLOCATE_VAR (b, assert_var,     var ())
 
 
+/*
+ * Profiling.
+ */
+
+#if HB_PROFILE
+#if (defined(__i386__) || defined(__x86_64__)) && (defined(__GNUC__) || defined(__clang__))
+/* __builtin_ia32_rdtsc(); <x86intrin.h> clashes with our posix_memalign. */
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#else
+#include <time.h>
+#endif
+
+static inline uint64_t
+_hb_profile_cycles (void)
+{
+#if (defined(__i386__) || defined(__x86_64__)) && (defined(__GNUC__) || defined(__clang__))
+  return __builtin_ia32_rdtsc ();
+#elif defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+  return __rdtsc ();
+#elif defined(CLOCK_MONOTONIC)
+  struct timespec ts;
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+#else
+  return 0;
+#endif
+}
+#else
+static inline uint64_t _hb_profile_cycles (void) { return 0; }
+#endif
+
+/* Reports the stage covering its lifetime to the buffer's profile func. */
+struct hb_buffer_profile_scope_t
+{
+  inline hb_buffer_profile_scope_t (hb_buffer_t *buffer_,
+				    hb_font_t *font_,
+				    hb_buffer_profile_stage_t stage_,
+				    hb_tag_t table_tag_ = 0,
+				    unsigned int lookup_index_ = 0) :
+				    buffer (buffer_),
+				    font (font_),
+				    stage (stage_),
+				    table_tag (table_tag_),
+				    lookup_index (lookup_index_),
+				    glyphs_in (0),
+				    lookups_run (0),
+				    lookups_skipped (0),
+				    start (0)
+  {
+    if (!buffer->profiling ()) return;
+    glyphs_in = buffer->len;
+    lookups_run = buffer->profile_lookups_run;
+    lookups_skipped = buffer->profile_lookups_skipped;
+    start = _hb_profile_cycles ();
+  }
+  inline ~hb_buffer_profile_scope_t (void)
+  {
+    if (!buffer->profiling ()) return;
+    buffer->profile_impl (font, stage, table_tag, lookup_index,
+			  _hb_profile_cycles () - start, glyphs_in,
+			  buffer->profile_lookups_run - lookups_run,
+			  buffer->profile_lookups_skipped - lookups_skipped);
+  }
+
+  private:
+  hb_buffer_t *buffer;
+  hb_font_t *font;
+  hb_buffer_profile_stage_t stage;
+  hb_tag_t table_tag;
+  unsigned int lookup_index;
+  unsigned int glyphs_in;
+  unsigned int lookups_run;
+  unsigned int lookups_skipped;
+  uint64_t start;
+};
+
+
 #endif /* HB_BUFFER_HH */
@@ -85,7 +85,22 @@ DEFINE_NULL_INSTANCE (hb_face_t) =
 #undef HB_SHAPER_IMPLEMENT
   },
 
-  HB_ATOMIC_PTR_INIT (nullptr), /* shape_plans */
+  {
+    HB_MUTEX_INIT, /* lock */
+    {}, /* buckets */
+    HB_ATOMIC_INT_INIT (0), /* epoch */
+    {HB_ATOMIC_INT_INIT (0), HB_ATOMIC_INT_INIT (0)}, /* readers */
+    nullptr, /* items */
+    0, /* len */
+    0, /* allocated */
+    0, /* max_plans */
+    0, /* hand */
+    {HB_ATOMIC_INT_INIT (hb_shape_plan_cache_t::UNKNOWN_VARIATIONS_INDEX),
+     HB_ATOMIC_INT_INIT (hb_shape_plan_cache_t::UNKNOWN_VARIATIONS_INDEX)}, /* default_variations_index */
+    HB_ATOMIC_INT_INIT (0), /* hits */
+    HB_ATOMIC_INT_INIT (0), /* misses */
+    HB_ATOMIC_INT_INIT (0), /* evictions */
+  } /* shape_plans */
 };
 
 
@@ -121,6 +136,8 @@ hb_face_create_for_tables (hb_reference_table_func_t  reference_table_func,
   face->upem = 0;
   face->num_glyphs = (unsigned int) -1;
 
+  face->shape_plans.init ();
+
   return face;
 }
 
@@ -252,13 +269,7 @@ hb_face_destroy (hb_face_t *face)
 {
   if (!hb_object_destroy (face)) return;
 
-  for (hb_face_t::plan_node_t *node = face->shape_plans.get (); node; )
-  {
-    hb_face_t::plan_node_t *next = node->next;
-    hb_shape_plan_destroy (node->shape_plan);
-    free (node);
-    node = next;
-  }
+  face->shape_plans.fini ();
 
 #define HB_SHAPER_IMPLEMENT(shaper) HB_SHAPER_DATA_DESTROY(shaper, face);
 #include "hb-shaper-list.hh"
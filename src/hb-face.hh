@@ -57,12 +57,7 @@ struct hb_face_t
   struct hb_shaper_data_t shaper_data;	/* Various shaper data. */
 
   /* Cache */
-  struct plan_node_t
-  {
-    hb_shape_plan_t *shape_plan;
-    plan_node_t *next;
-  };
-  hb_atomic_ptr_t<plan_node_t> shape_plans;
+  hb_shape_plan_cache_t shape_plans;
 
   inline hb_blob_t *reference_table (hb_tag_t tag) const
   {
@@ -32,6 +32,7 @@
 #include "hb-machinery.hh"
 
 #include "hb-ot.h"
+#include "hb-ot-layout-common.hh"
 
 
 /*
@@ -1281,6 +1282,8 @@ DEFINE_NULL_INSTANCE (hb_font_t) =
 
   true, /* immutable */
 
+  0, /* serial */
+
   nullptr, /* parent */
   const_cast<hb_face_t *> (&_hb_Null_hb_face_t),
 
@@ -1294,6 +1297,8 @@ DEFINE_NULL_INSTANCE (hb_font_t) =
   0, /* num_coords */
   nullptr, /* coords */
 
+  {}, /* var_scalars */
+
   const_cast<hb_font_funcs_t *> (&_hb_Null_hb_font_funcs_t), /* klass */
   nullptr, /* user_data */
   nullptr, /* destroy */
@@ -1448,6 +1453,7 @@ hb_font_destroy (hb_font_t *font)
   hb_font_funcs_destroy (font->klass);
 
   free (font->coords);
+  font->fini_var_scalars ();
 
   free (font);
 }
@@ -1593,9 +1599,12 @@ hb_font_set_face (hb_font_t *font,
   if (unlikely (!face))
     face = hb_face_get_empty ();
 
+  font->serial++;
+
   hb_face_t *old = font->face;
 
   font->face = hb_face_reference (face);
+  font->fini_var_scalars ();
 
   hb_face_destroy (old);
 }
@@ -1701,6 +1710,8 @@ hb_font_set_scale (hb_font_t *font,
   if (font->immutable)
     return;
 
+  font->serial++;
+
   font->x_scale = x_scale;
   font->y_scale = y_scale;
 }
@@ -1805,6 +1816,55 @@ hb_font_get_ptem (hb_font_t *font)
  * Variations
  */
 
+const float *
+hb_font_t::get_var_scalars (const OT::VarRegionList &regions)
+{
+  if (!num_coords)
+    return nullptr;
+
+  for (unsigned int i = 0; i < ARRAY_LENGTH (var_scalars); i++)
+  {
+  retry:
+    var_scalars_t *p = var_scalars[i].get ();
+    if (p)
+    {
+      if (p->regions == &regions)
+	return p->scalars;
+      continue;
+    }
+
+    unsigned int count = regions.get_region_count ();
+    if (!count)
+      return nullptr;
+    p = (var_scalars_t *) calloc (1, sizeof (var_scalars_t) + count * sizeof (float));
+    if (unlikely (!p))
+      return nullptr;
+    p->regions = &regions;
+    p->scalars = (float *) (p + 1);
+    regions.get_scalars (coords, num_coords, p->scalars);
+
+    if (unlikely (!var_scalars[i].cmpexch (nullptr, p)))
+    {
+      /* Another thread took this slot. */
+      free (p);
+      goto retry;
+    }
+    return p->scalars;
+  }
+
+  return nullptr;
+}
+
+void
+hb_font_t::fini_var_scalars (void)
+{
+  for (unsigned int i = 0; i < ARRAY_LENGTH (var_scalars); i++)
+  {
+    free (var_scalars[i].get ());
+    var_scalars[i].set_relaxed (nullptr);
+  }
+}
+
 static void
 _hb_font_adopt_var_coords_normalized (hb_font_t *font,
 				      int *coords, /* 2.14 normalized */
@@ -1812,8 +1872,11 @@ _hb_font_adopt_var_coords_normalized (hb_font_t *font,
 {
   free (font->coords);
 
+  font->serial++;
+
   font->coords = coords;
   font->num_coords = coords_length;
+  font->fini_var_scalars ();
 }
 
 /**
@@ -35,6 +35,11 @@
 #include "hb-shaper.hh"
 
 
+namespace OT {
+  struct VarRegionList;
+}
+
+
 /*
  * hb_font_funcs_t
  */
@@ -106,6 +111,10 @@ struct hb_font_t
 
   hb_bool_t immutable;
 
+  /* Bumped whenever the face, scale or variations change, so that
+   * per-font caches can tell when they are stale. */
+  unsigned int serial;
+
   hb_font_t *parent;
   hb_face_t *face;
 
@@ -121,6 +130,17 @@ struct hb_font_t
   unsigned int num_coords;
   int *coords;
 
+  /* Region scalars of the face's item variation stores (GDEF, HVAR, VVAR)
+   * at coords, so deltas don't re-evaluate the regions every time.  Each
+   * is computed the first time a delta needs it, and dropped whenever
+   * coords or face change; see get_var_scalars(). */
+  struct var_scalars_t
+  {
+    const OT::VarRegionList *regions;
+    float *scalars;
+  };
+  hb_atomic_ptr_t<var_scalars_t *> var_scalars[3];
+
   hb_font_funcs_t   *klass;
   void              *user_data;
   hb_destroy_func_t  destroy;
@@ -128,6 +148,12 @@ struct hb_font_t
   struct hb_shaper_data_t shaper_data;
 
 
+  /* Returns nullptr if there are no coords, or no memory for them, in
+   * which case deltas evaluate the regions on the fly. */
+  HB_INTERNAL const float *get_var_scalars (const OT::VarRegionList &regions);
+  HB_INTERNAL void fini_var_scalars (void);
+
+
   /* Convert from font-space to user-space */
   inline int dir_scale (hb_direction_t direction)
   { return HB_DIRECTION_IS_VERTICAL(direction) ? y_scale : x_scale; }
@@ -31,6 +31,7 @@
 #include "hb-glib.h"
 
 #include "hb-machinery.hh"
+#include "hb-unicode.hh"
 
 
 #if !GLIB_CHECK_VERSION(2,29,14)
@@ -343,6 +344,12 @@ static struct hb_glib_unicode_funcs_lazy_loader_t : hb_unicode_funcs_lazy_loader
     hb_unicode_funcs_set_compose_func (funcs, hb_glib_unicode_compose, nullptr, nullptr);
     hb_unicode_funcs_set_decompose_func (funcs, hb_glib_unicode_decompose, nullptr, nullptr);
 
+    if (likely (!hb_object_is_inert (funcs)))
+    {
+      funcs->canonical.compose = hb_glib_unicode_compose;
+      funcs->canonical.decompose = hb_glib_unicode_decompose;
+    }
+
     hb_unicode_funcs_make_immutable (funcs);
 
 #ifdef HB_USE_ATEXIT
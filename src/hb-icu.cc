@@ -32,6 +32,7 @@
 #include "hb-icu.h"
 
 #include "hb-machinery.hh"
+#include "hb-unicode.hh"
 
 #include <unicode/uchar.h>
 #include <unicode/unorm2.h>
@@ -123,6 +124,31 @@ hb_icu_unicode_general_category (hb_unicode_funcs_t *ufuncs HB_UNUSED,
   return HB_UNICODE_GENERAL_CATEGORY_UNASSIGNED;
 }
 
+static void
+hb_icu_unicode_general_categories (hb_unicode_funcs_t            *ufuncs,
+				   unsigned int                   count,
+				   const hb_codepoint_t          *first_unicode,
+				   unsigned int                   unicode_stride,
+				   hb_unicode_general_category_t *first_category,
+				   unsigned int                   category_stride,
+				   void                          *user_data HB_UNUSED)
+{
+  if (unlikely (ufuncs->func.general_category != hb_icu_unicode_general_category))
+  {
+    ufuncs->general_categories_one_by_one (count,
+					   first_unicode, unicode_stride,
+					   first_category, category_stride);
+    return;
+  }
+
+  for (unsigned int i = 0; i < count; i++)
+  {
+    *first_category = hb_icu_unicode_general_category (ufuncs, *first_unicode, nullptr);
+    first_unicode = &StructAtOffset<const hb_codepoint_t> (first_unicode, unicode_stride);
+    first_category = &StructAtOffset<hb_unicode_general_category_t> (first_category, category_stride);
+  }
+}
+
 static hb_codepoint_t
 hb_icu_unicode_mirroring (hb_unicode_funcs_t *ufuncs HB_UNUSED,
 			  hb_codepoint_t      unicode,
@@ -145,6 +171,31 @@ hb_icu_unicode_script (hb_unicode_funcs_t *ufuncs HB_UNUSED,
   return hb_icu_script_to_script (scriptCode);
 }
 
+static void
+hb_icu_unicode_scripts (hb_unicode_funcs_t   *ufuncs,
+			unsigned int          count,
+			const hb_codepoint_t *first_unicode,
+			unsigned int          unicode_stride,
+			hb_script_t          *first_script,
+			unsigned int          script_stride,
+			void                 *user_data HB_UNUSED)
+{
+  if (unlikely (ufuncs->func.script != hb_icu_unicode_script))
+  {
+    ufuncs->scripts_one_by_one (count,
+				first_unicode, unicode_stride,
+				first_script, script_stride);
+    return;
+  }
+
+  for (unsigned int i = 0; i < count; i++)
+  {
+    *first_script = hb_icu_unicode_script (ufuncs, *first_unicode, nullptr);
+    first_unicode = &StructAtOffset<const hb_codepoint_t> (first_unicode, unicode_stride);
+    first_script = &StructAtOffset<hb_script_t> (first_script, script_stride);
+  }
+}
+
 static hb_bool_t
 hb_icu_unicode_compose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
 			hb_codepoint_t      a,
@@ -313,6 +364,14 @@ static struct hb_icu_unicode_funcs_lazy_loader_t : hb_unicode_funcs_lazy_loader_
     hb_unicode_funcs_set_script_func (funcs, hb_icu_unicode_script, nullptr, nullptr);
     hb_unicode_funcs_set_compose_func (funcs, hb_icu_unicode_compose, user_data, nullptr);
     hb_unicode_funcs_set_decompose_func (funcs, hb_icu_unicode_decompose, user_data, nullptr);
+    hb_unicode_funcs_set_general_categories_func (funcs, hb_icu_unicode_general_categories, nullptr, nullptr);
+    hb_unicode_funcs_set_scripts_func (funcs, hb_icu_unicode_scripts, nullptr, nullptr);
+
+    if (likely (!hb_object_is_inert (funcs)))
+    {
+      funcs->canonical.compose = hb_icu_unicode_compose;
+      funcs->canonical.decompose = hb_icu_unicode_decompose;
+    }
 
     hb_unicode_funcs_make_immutable (funcs);
 
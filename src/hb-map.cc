@@ -257,3 +257,21 @@ hb_map_get_population (const hb_map_t *map)
 {
   return map->get_population ();
 }
+
+/**
+ * hb_map_keys:
+ * @map: a map.
+ * @keys: set to add the keys of @map to.
+ *
+ * Adds all the keys in @map to @keys.  Iterating @keys with hb_set_next()
+ * then visits them in increasing order; pair that with hb_map_get() to go
+ * over the map in key order.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_map_keys (const hb_map_t *map,
+	     hb_set_t       *keys)
+{
+  map->keys (keys);
+}
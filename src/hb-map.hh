@@ -28,6 +28,7 @@
 #define HB_MAP_HH
 
 #include "hb.hh"
+#include "hb-set.hh"
 
 
 template <typename T>
@@ -55,18 +56,22 @@ struct hb_map_t
 
   hb_object_header_t header;
   bool successful; /* Allocations successful */
+  bool dense; /* Items are indexed by key, not hashed. */
   unsigned int population; /* Not including tombstones. */
   unsigned int occupancy; /* Including tombstones. */
   unsigned int mask;
   unsigned int prime;
+  hb_codepoint_t max_key; /* Largest key ever set. */
   item_t *items;
 
   inline void init_shallow (void)
   {
     successful = true;
+    dense = false;
     population = occupancy = 0;
     mask = 0;
     prime = 0;
+    max_key = 0;
     items = nullptr;
   }
   inline void init (void)
@@ -84,11 +89,27 @@ struct hb_map_t
     fini_shallow ();
   }
 
-  inline bool resize (void)
+  /* Makes room for count keys, none above max_key, so that setting them
+   * does not resize the map again.  The table is sized for count, so it
+   * should be the number of keys that will actually be set, not an upper
+   * bound on it; items are only indexed by key if they fit in that. */
+  inline bool alloc (unsigned int count, hb_codepoint_t max_key_)
   {
     if (unlikely (!successful)) return false;
+    if (unlikely (max_key_ == INVALID)) return true;
+    /* There cannot be more keys than that. */
+    count = MIN (count, max_key_ + 1);
+    max_key = MAX (max_key, max_key_);
+    return resize (count);
+  }
 
-    unsigned int power = hb_bit_storage (population * 2 + 8);
+  inline bool resize (unsigned int count = 0)
+  {
+    if (unlikely (!successful)) return false;
+
+    unsigned int power = hb_bit_storage (MAX (population, count) * 2 + 8);
+    if (items)
+      power = MAX (power, hb_bit_storage (mask));
     unsigned int new_size = 1u << power;
     item_t *new_items = (item_t *) malloc ((size_t) new_size * sizeof (item_t));
     if (unlikely (!new_items))
@@ -101,10 +122,13 @@ struct hb_map_t
     unsigned int old_size = mask + 1;
     item_t *old_items = items;
 
-    /* Switch to new, empty, array. */
+    /* Switch to new, empty, array.  If every key fits in it, which is
+     * common for glyph and lookup indices, store each at its own index;
+     * the table is no larger than a hashed one would be. */
     population = occupancy = 0;
     mask = new_size - 1;
     prime = prime_for (power);
+    dense = max_key <= mask;
     items = new_items;
 
     /* Insert back old items. */
@@ -122,7 +146,16 @@ struct hb_map_t
   {
     if (unlikely (!successful)) return;
     if (unlikely (key == INVALID)) return;
-    if ((occupancy + occupancy / 2) >= mask && !resize ()) return;
+    if (!dense && (occupancy + occupancy / 2) >= mask && !resize ()) return;
+    if (dense && key > mask)
+    {
+      if (value == INVALID)
+	return; /* Trying to delete non-existent key. */
+      max_key = key;
+      if (!resize ()) return;
+    }
+    else if (value != INVALID)
+      max_key = MAX (max_key, key);
     unsigned int i = bucket_for (key);
 
     if (value == INVALID && items[i].key != key)
@@ -131,7 +164,7 @@ struct hb_map_t
     if (!items[i].is_unused ())
     {
       occupancy--;
-      if (items[i].is_tombstone ())
+      if (!items[i].is_tombstone ())
 	population--;
     }
 
@@ -146,6 +179,8 @@ struct hb_map_t
   inline hb_codepoint_t get (hb_codepoint_t key) const
   {
     if (unlikely (!items)) return INVALID;
+    if (dense)
+      return key <= mask ? items[key].value : INVALID;
     unsigned int i = bucket_for (key);
     return items[i].key == key ? items[i].value : INVALID;
   }
@@ -166,13 +201,14 @@ struct hb_map_t
 
   inline void clear (void)
   {
-    memset (items, 0xFF, ((size_t) mask + 1) * sizeof (item_t));
+    if (items)
+      memset (items, 0xFF, ((size_t) mask + 1) * sizeof (item_t));
     population = occupancy = 0;
   }
 
   inline bool is_empty (void) const
   {
-    return population != 0;
+    return population == 0;
   }
 
   inline unsigned int get_population () const
@@ -180,10 +216,21 @@ struct hb_map_t
     return population;
   }
 
+  /* Adds the keys to a set; iterating it visits them in order. */
+  inline void keys (hb_set_t *keys_) const
+  {
+    if (unlikely (!items)) return;
+    for (unsigned int i = 0; i <= mask; i++)
+      if (!items[i].is_unused () && !items[i].is_tombstone ())
+	keys_->add (items[i].key);
+  }
+
   protected:
 
   inline unsigned int bucket_for (hb_codepoint_t key) const
   {
+    if (dense)
+      return key;
     unsigned int i = Hash (key) % prime;
     unsigned int step = 0;
     unsigned int tombstone = INVALID;
@@ -29,6 +29,7 @@
 #include "hb-ot.h"
 
 #include "hb-font.hh"
+#include "hb-cache.hh"
 #include "hb-machinery.hh"
 #include "hb-ot-face.hh"
 
@@ -40,6 +41,79 @@
 #include "hb-ot-color-cbdt-table.hh"
 
 
+/*
+ * hb_ot_font_t
+ *
+ * Per-font data for the OT font funcs.  Holds caches in front of the
+ * face-level accelerators, which are too slow to hit for every glyph.
+ */
+
+struct hb_ot_font_t
+{
+  const hb_ot_face_data_t *ot_face;
+
+  /* Most cmap subtables, formats 4 and 12 in particular, need a binary
+   * search per lookup; running text repeats characters a lot. */
+  mutable hb_cmap_cache_t cmap_cache;
+
+  /* Scaled horizontal advances of a variable instance.  Applying the HVAR
+   * deltas means walking the ItemVariationStore for every glyph, so keep
+   * the result until the font's scale or coords change. */
+  mutable hb_atomic_int_t cached_serial;
+  mutable hb_advance_cache_t h_advance_cache;
+
+  inline bool get_nominal_glyph (hb_codepoint_t unicode,
+				 hb_codepoint_t *glyph) const
+  {
+    unsigned int v;
+    if (cmap_cache.get (unicode, &v))
+    {
+      *glyph = v;
+      return true;
+    }
+    if (!ot_face->cmap->get_nominal_glyph (unicode, glyph))
+      return false;
+    cmap_cache.set (unicode, *glyph);
+    return true;
+  }
+
+  inline void check_serial (hb_font_t *font) const
+  {
+    if ((int) font->serial != cached_serial.get ())
+    {
+      h_advance_cache.clear ();
+      cached_serial.set (font->serial);
+    }
+  }
+};
+
+static hb_ot_font_t *
+_hb_ot_font_create (hb_face_t *face)
+{
+  hb_ot_font_t *ot_font = (hb_ot_font_t *) calloc (1, sizeof (hb_ot_font_t));
+  if (unlikely (!ot_font))
+    return nullptr;
+
+  ot_font->ot_face = hb_ot_face_data (face);
+  ot_font->cmap_cache.init ();
+  ot_font->cached_serial.set_relaxed (-1);
+  ot_font->h_advance_cache.init ();
+
+  return ot_font;
+}
+
+static void
+_hb_ot_font_destroy (void *data)
+{
+  hb_ot_font_t *ot_font = (hb_ot_font_t *) data;
+
+  ot_font->cmap_cache.fini ();
+  ot_font->h_advance_cache.fini ();
+
+  free (ot_font);
+}
+
+
 static hb_bool_t
 hb_ot_get_nominal_glyph (hb_font_t *font HB_UNUSED,
 			 void *font_data,
@@ -47,8 +121,8 @@ hb_ot_get_nominal_glyph (hb_font_t *font HB_UNUSED,
 			 hb_codepoint_t *glyph,
 			 void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
-  return ot_face->cmap.get ()->get_nominal_glyph (unicode, glyph);
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  return ot_font->get_nominal_glyph (unicode, glyph);
 }
 
 static unsigned int
@@ -61,11 +135,10 @@ hb_ot_get_nominal_glyphs (hb_font_t *font HB_UNUSED,
 			  unsigned int glyph_stride,
 			  void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
-  const OT::cmap_accelerator_t &cmap = *ot_face->cmap.get ();
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
   unsigned int done;
   for (done = 0;
-       done < count && cmap.get_nominal_glyph (*first_unicode, first_glyph);
+       done < count && ot_font->get_nominal_glyph (*first_unicode, first_glyph);
        done++)
   {
     first_unicode = &StructAtOffset<hb_codepoint_t> (first_unicode, unicode_stride);
@@ -82,7 +155,7 @@ hb_ot_get_variation_glyph (hb_font_t *font HB_UNUSED,
 			   hb_codepoint_t *glyph,
 			   void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   return ot_face->cmap.get ()->get_variation_glyph (unicode, variation_selector, glyph);
 }
 
@@ -95,8 +168,27 @@ hb_ot_get_glyph_h_advances (hb_font_t* font, void* font_data,
 			    unsigned advance_stride,
 			    void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
-  const OT::hmtx_accelerator_t &hmtx = *ot_face->hmtx.get ();
+  const hb_ot_font_t *ot_font = (const hb_ot_font_t *) font_data;
+  const OT::hmtx_accelerator_t &hmtx = *ot_font->ot_face->hmtx.get ();
+
+  if (font->num_coords)
+  {
+    ot_font->check_serial (font);
+    for (unsigned int i = 0; i < count; i++)
+    {
+      unsigned int cv;
+      if (ot_font->h_advance_cache.get (*first_glyph, &cv))
+	*first_advance = cv;
+      else
+      {
+	*first_advance = font->em_scale_x (hmtx.get_advance (*first_glyph, font));
+	ot_font->h_advance_cache.set (*first_glyph, *first_advance);
+      }
+      first_glyph = &StructAtOffset<hb_codepoint_t> (first_glyph, glyph_stride);
+      first_advance = &StructAtOffset<hb_position_t> (first_advance, advance_stride);
+    }
+    return;
+  }
 
   for (unsigned int i = 0; i < count; i++)
   {
@@ -115,7 +207,7 @@ hb_ot_get_glyph_v_advances (hb_font_t* font, void* font_data,
 			    unsigned advance_stride,
 			    void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   const OT::vmtx_accelerator_t &vmtx = *ot_face->vmtx.get ();
 
   for (unsigned int i = 0; i < count; i++)
@@ -134,7 +226,7 @@ hb_ot_get_glyph_v_origin (hb_font_t *font,
 			  hb_position_t *y,
 			  void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
 
   *x = font->get_glyph_h_advance (glyph) / 2;
 
@@ -162,7 +254,7 @@ hb_ot_get_glyph_extents (hb_font_t *font,
 			 hb_glyph_extents_t *extents,
 			 void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   bool ret = ot_face->glyf->get_extents (glyph, extents);
   if (!ret)
     ret = ot_face->CBDT->get_extents (glyph, extents);
@@ -181,7 +273,7 @@ hb_ot_get_glyph_name (hb_font_t *font HB_UNUSED,
                       char *name, unsigned int size,
                       void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   return ot_face->post->get_glyph_name (glyph, name, size);
 }
 
@@ -192,7 +284,7 @@ hb_ot_get_glyph_from_name (hb_font_t *font HB_UNUSED,
                            hb_codepoint_t *glyph,
                            void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   return ot_face->post->get_glyph_from_name (name, len, glyph);
 }
 
@@ -202,7 +294,7 @@ hb_ot_get_font_h_extents (hb_font_t *font,
 			  hb_font_extents_t *metrics,
 			  void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   const OT::hmtx_accelerator_t &hmtx = *ot_face->hmtx.get ();
   metrics->ascender = font->em_scale_y (hmtx.ascender);
   metrics->descender = font->em_scale_y (hmtx.descender);
@@ -217,7 +309,7 @@ hb_ot_get_font_v_extents (hb_font_t *font,
 			  hb_font_extents_t *metrics,
 			  void *user_data HB_UNUSED)
 {
-  const hb_ot_face_data_t *ot_face = (const hb_ot_face_data_t *) font_data;
+  const hb_ot_face_data_t *ot_face = ((const hb_ot_font_t *) font_data)->ot_face;
   const OT::vmtx_accelerator_t &vmtx = *ot_face->vmtx.get ();
   metrics->ascender = font->em_scale_x (vmtx.ascender);
   metrics->descender = font->em_scale_x (vmtx.descender);
@@ -284,10 +376,11 @@ void
 hb_ot_font_set_funcs (hb_font_t *font)
 {
   if (unlikely (!hb_ot_shaper_face_data_ensure (font->face))) return;
-  hb_ot_face_data_t *ot_face = hb_ot_face_data (font->face);
+  hb_ot_font_t *ot_font = _hb_ot_font_create (font->face);
+  if (unlikely (!ot_font)) return;
 
   hb_font_set_funcs (font,
 		     _hb_ot_get_font_funcs (),
-		     ot_face,
-		     nullptr);
+		     ot_font,
+		     _hb_ot_font_destroy);
 }
@@ -284,7 +284,7 @@ struct hmtxvmtx
       unsigned int advance = get_advance (glyph);
       if (likely(glyph < num_metrics))
       {
-	advance += (font->num_coords ? var_table->get_advance_var (glyph, font->coords, font->num_coords) : 0); // TODO Optimize?!
+	advance += (font->num_coords ? var_table->get_advance_var (glyph, font) : 0);
       }
       return advance;
     }
@@ -1475,11 +1475,15 @@ struct VarRegionAxis
 struct VarRegionList
 {
   inline float evaluate (unsigned int region_index,
-			 int *coords, unsigned int coord_len) const
+			 int *coords, unsigned int coord_len,
+			 const float *scalars = nullptr) const
   {
     if (unlikely (region_index >= regionCount))
       return 0.;
 
+    if (scalars)
+      return scalars[region_index];
+
     const VarRegionAxis *axes = axesZ.arrayZ + (region_index * axisCount);
 
     float v = 1.;
@@ -1495,6 +1499,19 @@ struct VarRegionList
     return v;
   }
 
+  inline unsigned int get_region_count (void) const { return regionCount; }
+
+  /* Evaluates every region at once; scalars must hold get_region_count()
+   * values.  The result can be passed to the get_delta() calls below for
+   * as long as the coords stay the same. */
+  inline void get_scalars (int *coords, unsigned int coord_len,
+			   float *scalars) const
+  {
+    unsigned int count = regionCount;
+    for (unsigned int i = 0; i < count; i++)
+      scalars[i] = evaluate (i, coords, coord_len);
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -1521,7 +1538,8 @@ struct VarData
 
   inline float get_delta (unsigned int inner,
 			  int *coords, unsigned int coord_count,
-			  const VarRegionList &regions) const
+			  const VarRegionList &regions,
+			  const float *scalars = nullptr) const
   {
     if (unlikely (inner >= itemCount))
       return 0.;
@@ -1538,13 +1556,13 @@ struct VarData
    const HBINT16 *scursor = reinterpret_cast<const HBINT16 *> (row);
    for (; i < scount; i++)
    {
-     float scalar = regions.evaluate (regionIndices.arrayZ[i], coords, coord_count);
+     float scalar = regions.evaluate (regionIndices.arrayZ[i], coords, coord_count, scalars);
      delta += scalar * *scursor++;
    }
    const HBINT8 *bcursor = reinterpret_cast<const HBINT8 *> (scursor);
    for (; i < count; i++)
    {
-     float scalar = regions.evaluate (regionIndices.arrayZ[i], coords, coord_count);
+     float scalar = regions.evaluate (regionIndices.arrayZ[i], coords, coord_count, scalars);
      delta += scalar * *bcursor++;
    }
 
@@ -1591,6 +1609,28 @@ struct VariationStore
     return get_delta (outer, inner, coords, coord_count);
   }
 
+  /* Same, at the font's coords, using the region scalars the font
+   * precomputed for this store if there are any. */
+  inline float get_delta (unsigned int outer, unsigned int inner,
+			  hb_font_t *font) const
+  {
+    if (unlikely (outer >= dataSets.len))
+      return 0.;
+
+    const VarRegionList &region_list = this+regions;
+    return (this+dataSets[outer]).get_delta (inner,
+					     font->coords, font->num_coords,
+					     region_list,
+					     font->get_var_scalars (region_list));
+  }
+
+  inline float get_delta (unsigned int index, hb_font_t *font) const
+  {
+    unsigned int outer = index >> 16;
+    unsigned int inner = index & 0xFFFF;
+    return get_delta (outer, inner, font);
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -1908,7 +1948,7 @@ struct VariationDevice
 
   inline float get_delta (hb_font_t *font, const VariationStore &store) const
   {
-    return store.get_delta (outerIndex, innerIndex, font->coords, font->num_coords);
+    return store.get_delta (outerIndex, innerIndex, font);
   }
 
   protected:
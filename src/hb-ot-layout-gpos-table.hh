@@ -644,23 +644,16 @@ struct PairSet
     c->input->add_array (&record->secondGlyph, len, record_size);
   }
 
-  inline bool apply (hb_ot_apply_context_t *c,
-		     const ValueFormat *valueFormats,
-		     unsigned int pos) const
+  /* Returns the index of the record for second glyph x, or -1. */
+  inline int find (hb_codepoint_t x,
+		   const ValueFormat *valueFormats) const
   {
-    TRACE_APPLY (this);
-    hb_buffer_t *buffer = c->buffer;
     unsigned int len1 = valueFormats[0].get_len ();
     unsigned int len2 = valueFormats[1].get_len ();
     unsigned int record_size = HBUINT16::static_size * (1 + len1 + len2);
 
-    unsigned int count = len;
-
     /* Hand-coded bsearch. */
-    if (unlikely (!count))
-      return_trace (false);
-    hb_codepoint_t x = buffer->info[pos].codepoint;
-    int min = 0, max = (int) count - 1;
+    int min = 0, max = (int) len - 1;
     while (min <= max)
     {
       int mid = (min + max) / 2;
@@ -671,18 +664,41 @@ struct PairSet
       else if (x > mid_x)
         min = mid + 1;
       else
-      {
-        buffer->unsafe_to_break (buffer->idx, pos + 1);
-	valueFormats[0].apply_value (c, this, &record->values[0], buffer->cur_pos());
-	valueFormats[1].apply_value (c, this, &record->values[len1], buffer->pos[pos]);
-	if (len2)
-	  pos++;
-	buffer->idx = pos;
-	return_trace (true);
-      }
+        return mid;
     }
+    return -1;
+  }
 
-    return_trace (false);
+  inline bool apply_record (hb_ot_apply_context_t *c,
+			    const ValueFormat *valueFormats,
+			    unsigned int pos,
+			    unsigned int i) const
+  {
+    TRACE_APPLY (this);
+    hb_buffer_t *buffer = c->buffer;
+    unsigned int len1 = valueFormats[0].get_len ();
+    unsigned int len2 = valueFormats[1].get_len ();
+    unsigned int record_size = HBUINT16::static_size * (1 + len1 + len2);
+
+    const PairValueRecord *record = &StructAtOffset<PairValueRecord> (&firstPairValueRecord, record_size * i);
+    buffer->unsafe_to_break (buffer->idx, pos + 1);
+    valueFormats[0].apply_value (c, this, &record->values[0], buffer->cur_pos());
+    valueFormats[1].apply_value (c, this, &record->values[len1], buffer->pos[pos]);
+    if (len2)
+      pos++;
+    buffer->idx = pos;
+    return_trace (true);
+  }
+
+  inline bool apply (hb_ot_apply_context_t *c,
+		     const ValueFormat *valueFormats,
+		     unsigned int pos) const
+  {
+    TRACE_APPLY (this);
+    int i = find (c->buffer->info[pos].codepoint, valueFormats);
+    if (i < 0)
+      return_trace (false);
+    return_trace (apply_record (c, valueFormats, pos, i));
   }
 
   struct sanitize_closure_t
@@ -746,6 +762,9 @@ struct PairPosFormat1
   {
     TRACE_APPLY (this);
     hb_buffer_t *buffer = c->buffer;
+    if (c->pair_cache)
+      return_trace (apply_cached (c));
+
     unsigned int index = (this+coverage).get_coverage  (buffer->cur().codepoint);
     if (likely (index == NOT_COVERED)) return_trace (false);
 
@@ -756,6 +775,45 @@ struct PairPosFormat1
     return_trace ((this+pairSet[index]).apply (c, valueFormat, skippy_iter.idx));
   }
 
+  /* Finds the second glyph first, and then looks the pair up in the
+   * pair cache before searching the Coverage and the PairSet.  The
+   * first glyph is most likely covered here, having passed the coverage
+   * bitmap of the subtable. */
+  inline bool apply_cached (hb_ot_apply_context_t *c) const
+  {
+    hb_buffer_t *buffer = c->buffer;
+    hb_ot_apply_context_t::skipping_iterator_t &skippy_iter = c->iter_input;
+    skippy_iter.reset (buffer->idx, 1);
+    if (!skippy_iter.next ()) return false;
+
+    hb_codepoint_t first = buffer->cur().codepoint;
+    hb_codepoint_t second = buffer->info[skippy_iter.idx].codepoint;
+    if (unlikely ((first | second) > 0xFFFFu))
+    {
+      /* Out of the range the pair cache keys on. */
+      unsigned int index = (this+coverage).get_coverage (first);
+      if (index == NOT_COVERED) return false;
+      return (this+pairSet[index]).apply (c, valueFormat, skippy_iter.idx);
+    }
+    unsigned int value;
+    if (!c->pair_cache->get (this, first, second, &value))
+    {
+      value = hb_pair_cache_t::NOT_FOUND;
+      unsigned int index = (this+coverage).get_coverage (first);
+      if (index != NOT_COVERED)
+      {
+	int i = (this+pairSet[index]).find (second, valueFormat);
+	if (i >= 0)
+	  value = (index << 16) | i;
+      }
+      c->pair_cache->set (this, first, second, value);
+    }
+    if (value == hb_pair_cache_t::NOT_FOUND)
+      return false;
+
+    return (this+pairSet[value >> 16]).apply_record (c, valueFormat, skippy_iter.idx, value & 0xFFFF);
+  }
+
   inline bool subset (hb_subset_context_t *c) const
   {
     TRACE_SUBSET (this);
@@ -833,8 +891,8 @@ struct PairPosFormat2
     unsigned int len2 = valueFormat2.get_len ();
     unsigned int record_len = len1 + len2;
 
-    unsigned int klass1 = (this+classDef1).get_class (buffer->cur().codepoint);
-    unsigned int klass2 = (this+classDef2).get_class (buffer->info[skippy_iter.idx].codepoint);
+    unsigned int klass1 = c->get_class (this+classDef1, buffer->cur().codepoint);
+    unsigned int klass2 = c->get_class (this+classDef2, buffer->info[skippy_iter.idx].codepoint);
     if (unlikely (klass1 >= class1Count || klass2 >= class2Count)) return_trace (false);
 
     buffer->unsafe_to_break (buffer->idx, skippy_iter.idx + 1);
@@ -856,6 +914,13 @@ struct PairPosFormat2
     return_trace (false);
   }
 
+  inline unsigned int get_class_defs (const ClassDef *class_defs[3]) const
+  {
+    class_defs[0] = &(this+classDef1);
+    class_defs[1] = &(this+classDef2);
+    return 2;
+  }
+
   inline bool sanitize (hb_sanitize_context_t *c) const
   {
     TRACE_SANITIZE (this);
@@ -904,6 +969,10 @@ struct PairPosFormat2
   DEFINE_SIZE_ARRAY (16, values);
 };
 
+static inline unsigned int
+get_class_defs (const PairPosFormat2 &obj, const ClassDef *class_defs[3])
+{ return obj.get_class_defs (class_defs); }
+
 struct PairPos
 {
   template <typename context_t>
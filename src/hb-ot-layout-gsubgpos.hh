@@ -38,6 +38,20 @@
 #include "hb-ot-layout-gdef-table.hh"
 
 
+/* Bytes of coverage bitmaps and of class arrays, respectively, that the
+ * lookup accelerators of each of GSUB and GPOS may allocate per face. */
+#ifndef HB_OT_LAYOUT_COVERAGE_BITMAP_BUDGET
+#define HB_OT_LAYOUT_COVERAGE_BITMAP_BUDGET (256 * 1024)
+#endif
+#ifndef HB_OT_LAYOUT_CLASS_CACHE_BUDGET
+#define HB_OT_LAYOUT_CLASS_CACHE_BUDGET (512 * 1024)
+#endif
+/* Bytes of the glyph-to-lookups index of each of GSUB and GPOS per face. */
+#ifndef HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET
+#define HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET (1024 * 1024)
+#endif
+
+
 namespace OT {
 
 
@@ -259,6 +273,390 @@ struct hb_add_coverage_context_t :
 };
 
 
+/* What the lookup accelerators of one table spent on compiled coverage
+ * and class tables, and on the lookup index, against their budgets. */
+struct hb_accelerator_memory_t
+{
+  hb_atomic_int_t coverage_bytes; /* Grows as bitmaps are compiled on use. */
+  unsigned int class_bytes;
+  unsigned int index_bytes;
+};
+
+/* Set interface, for add_coverage(), that finds the first and last glyph
+ * added. */
+struct hb_glyph_span_t
+{
+  inline bool add_range (hb_codepoint_t a, hb_codepoint_t b)
+  {
+    if (unlikely (a > b))
+      return false;
+    first = MIN (first, a);
+    last = MAX (last, b);
+    count += b - a + 1;
+    return true;
+  }
+  template <typename T>
+  inline bool add_sorted_array (const T *array, unsigned int count_, unsigned int stride=sizeof(T))
+  {
+    for (unsigned int i = 0; i < count_; i++)
+    {
+      add_range (*array, *array);
+      array = (const T *) (stride + (const char *) array);
+    }
+    return true;
+  }
+
+  hb_codepoint_t first, last;
+  unsigned int count;
+};
+
+/* The glyphs of a Coverage table as a bitmap spanning its first to last
+ * glyph.  Unlike the set digest it has no false positives, so subtables
+ * with wide coverage skip glyphs they don't cover without the binary
+ * search in Coverage::get_coverage().
+ *
+ * Compiled the first time a glyph gets past the digest, so loading a face
+ * doesn't pay for the subtables of lookups that text never reaches.  The
+ * accelerators are shared between threads; whichever finishes compiling
+ * first publishes its bitmap and the others throw theirs away. */
+struct hb_coverage_bitmap_t
+{
+  inline void init (const Coverage &coverage_, hb_accelerator_memory_t *memory_)
+  {
+    coverage = &coverage_;
+    memory = memory_;
+    data.init ();
+  }
+  inline void fini (void)
+  {
+    data_t *d = data.get ();
+    if (d && d != &Null(data_t))
+      free (d);
+    data.init ();
+  }
+
+  /* Only compiles coverages of at least this many glyphs; the digest
+   * already does well on fewer. */
+  enum { MIN_GLYPHS = 8 };
+
+  inline bool may_have (hb_codepoint_t g) const
+  {
+    const data_t *d = data.get ();
+    if (unlikely (!d))
+      d = compile ();
+    if (d == &Null(data_t))
+      return true;
+    g -= d->start;
+    return g < d->length && (d->bits[g >> 5] & (1u << (g & 31)));
+  }
+
+  private:
+  struct data_t
+  {
+    hb_codepoint_t start;
+    unsigned int length;
+    unsigned int size; /* Of bits, in bytes. */
+    uint32_t bits[VAR];
+
+    /* Set interface for Coverage::add_coverage(). */
+    inline bool add_range (hb_codepoint_t a, hb_codepoint_t b)
+    {
+      for (hb_codepoint_t g = a - start; g <= b - start; g++)
+	bits[g >> 5] |= 1u << (g & 31);
+      return true;
+    }
+    template <typename T>
+    inline bool add_sorted_array (const T *array, unsigned int count, unsigned int stride=sizeof(T))
+    {
+      for (unsigned int i = 0; i < count; i++)
+      {
+	hb_codepoint_t g = *array - start;
+	bits[g >> 5] |= 1u << (g & 31);
+	array = (const T *) (stride + (const char *) array);
+      }
+      return true;
+    }
+  };
+
+  /* Publishes the Null bitmap, which matches everything, if the budget is
+   * spent or the table is broken. */
+  inline const data_t *compile (void) const
+  {
+    data_t *d = const_cast<data_t *> (&Null(data_t));
+    hb_glyph_span_t span = {HB_SET_VALUE_INVALID, 0, 0};
+    if (coverage->add_coverage (&span) &&
+	span.count >= MIN_GLYPHS)
+    {
+      unsigned int size = (((span.last - span.first) >> 5) + 1) * sizeof (d->bits[0]);
+      /* Reserve the bytes first, so racing threads can't overspend. */
+      if (size <= HB_OT_LAYOUT_COVERAGE_BITMAP_BUDGET)
+      {
+	unsigned int spent = hb_atomic_int_impl_add (&memory->coverage_bytes.v, size);
+	if (spent <= HB_OT_LAYOUT_COVERAGE_BITMAP_BUDGET - size)
+	{
+	  data_t *bitmap = (data_t *) calloc (1, sizeof (data_t) - sizeof (d->bits) + size);
+	  if (likely (bitmap))
+	  {
+	    bitmap->start = span.first;
+	    bitmap->length = span.last - span.first + 1;
+	    bitmap->size = size;
+	    if (likely (coverage->add_coverage (bitmap)))
+	      d = bitmap;
+	    else
+	      free (bitmap);
+	  }
+	}
+	if (d == &Null(data_t))
+	  hb_atomic_int_impl_add (&memory->coverage_bytes.v, -(int) size);
+      }
+    }
+
+    if (unlikely (!data.cmpexch (nullptr, d)))
+    {
+      if (d != &Null(data_t))
+      {
+	hb_atomic_int_impl_add (&memory->coverage_bytes.v, -(int) d->size);
+	free (d);
+      }
+      d = data.get ();
+    }
+    return d;
+  }
+
+  const Coverage *coverage;
+  hb_accelerator_memory_t *memory;
+  hb_atomic_ptr_t<data_t *> data;
+};
+
+/* A ClassDef flattened into a glyph-to-class array over the span of
+ * glyphs it gives a non-zero class, so PairPosFormat2 and the class-based
+ * (Chain)Context subtables look classes up without a binary search.
+ * Glyphs outside the span, or all of them if the budget was spent, go to
+ * the ClassDef itself. */
+struct hb_class_cache_t
+{
+  inline void init (const ClassDef &class_def_)
+  {
+    class_def = &class_def_;
+    start = 0;
+    length = 0;
+    classes = nullptr;
+  }
+  inline void fini (void)
+  {
+    free (classes);
+    classes = nullptr;
+    length = 0;
+  }
+
+  inline void compile (hb_accelerator_memory_t *memory)
+  {
+    hb_glyph_span_t span = {HB_SET_VALUE_INVALID, 0, 0};
+    if (!class_def->add_coverage (&span) ||
+	span.first > span.last)
+      return;
+
+    unsigned int count = span.last - span.first + 1;
+    unsigned int size = count * sizeof (classes[0]);
+    if (size > HB_OT_LAYOUT_CLASS_CACHE_BUDGET - memory->class_bytes)
+      return;
+    classes = (uint16_t *) malloc (size);
+    if (unlikely (!classes))
+      return;
+    for (unsigned int i = 0; i < count; i++)
+      classes[i] = class_def->get_class (span.first + i);
+    start = span.first;
+    length = count;
+    memory->class_bytes += size;
+  }
+
+  inline unsigned int get_class (hb_codepoint_t g) const
+  {
+    unsigned int i = g - start;
+    if (likely (i < length))
+      return classes[i];
+    return class_def->get_class (g);
+  }
+
+  const ClassDef *class_def;
+  private:
+  hb_codepoint_t start;
+  unsigned int length;
+  uint16_t *classes;
+};
+
+/* Remembers what pairs of glyphs resolved to in the PairPosFormat1
+ * subtables applied during one GPOS pass: the coverage index of the
+ * first glyph and the record of the second in its PairSet, or that
+ * there is none.  Running text kerns the same pairs over and over, and
+ * mostly skips the Coverage and PairSet searches this way.
+ * Direct-mapped; a pair replaces whatever pair was in its slot.  Keys
+ * pack both glyphs in 32 bits, so only pairs of glyphs up to 0xFFFF
+ * may be stored; callers look other pairs up directly. */
+struct hb_pair_cache_t
+{
+  enum { CACHE_BITS = 10 };
+  /* Buffers shorter than this don't repeat enough pairs to pay for
+   * allocating and clearing the cache. */
+  enum { MIN_LEN = 32 };
+  static const unsigned int NOT_FOUND = (unsigned int) -1;
+
+  inline void init (void)
+  {
+    for (unsigned int i = 0; i < ARRAY_LENGTH (items); i++)
+      items[i].subtable = nullptr;
+  }
+
+  inline bool get (const void *subtable,
+		   hb_codepoint_t first,
+		   hb_codepoint_t second,
+		   unsigned int *value) const
+  {
+    uint32_t pair = (first << 16) | second;
+    const item_t &item = items[slot (subtable, pair)];
+    if (item.subtable != subtable || item.pair != pair)
+      return false;
+    *value = item.value;
+    return true;
+  }
+
+  inline void set (const void *subtable,
+		   hb_codepoint_t first,
+		   hb_codepoint_t second,
+		   unsigned int value)
+  {
+    uint32_t pair = (first << 16) | second;
+    item_t &item = items[slot (subtable, pair)];
+    item.subtable = subtable;
+    item.pair = pair;
+    item.value = value;
+  }
+
+  private:
+  static inline unsigned int slot (const void *subtable, uint32_t pair)
+  {
+    uint32_t h = (pair ^ (uint32_t) (uintptr_t) subtable) * 2654435761u;
+    return h >> (32 - CACHE_BITS);
+  }
+
+  struct item_t
+  {
+    const void *subtable;
+    uint32_t pair;
+    uint32_t value;
+  };
+  item_t items[1u << CACHE_BITS];
+};
+
+/* The ClassDefs a subtable looks up, for hb_class_cache_t.  Overloaded
+ * below by the subtable types that use ClassDefs while applying. */
+template <typename T>
+static inline unsigned int
+get_class_defs (const T &obj HB_UNUSED, const ClassDef *class_defs[3] HB_UNUSED)
+{ return 0; }
+
+
+struct hb_ot_apply_context_t;
+
+/* Whether check_glyph_property() rejects each glyph in the buffer for
+ * the props of the lookup being applied, one bit each, worked out the
+ * first time an iterator asks about the glyph.  That way the mark
+ * filtering set of a glyph is searched once per lookup instead of once
+ * per match attempt, and the iterators step over runs of glyphs already
+ * known to be skipped with a bit-scan.
+ *
+ * In GSUB the glyphs before the cursor are replaced by the output as the
+ * lookup goes, and move_to() renumbers the rest when it moves glyphs
+ * back; so there only next() uses the bits, and only until the buffer
+ * rewinds.
+ *
+ * The bits live in the buffer's scratch memory, from scratch_offset on,
+ * so they cost no allocation once the buffer has shaped text as long. */
+struct hb_skip_bits_t
+{
+  inline void init (unsigned int scratch_offset_)
+  {
+    c = nullptr;
+    lookup_props = 0;
+    rewinds = 0;
+    active = false;
+    scratch_offset = scratch_offset_;
+    known = skip = nullptr;
+  }
+
+  /* Scratch bytes the bits take for a buffer of len glyphs. */
+  static inline unsigned int scratch_size (unsigned int len)
+  { return 2 * ((len + 31) >> 5) * sizeof (uint32_t); }
+
+  /* Called before each lookup is applied to the buffer. */
+  inline void reset (const hb_ot_apply_context_t *c_, bool reverse);
+
+  inline bool usable (unsigned int lookup_props_,
+		      const hb_buffer_t *buffer) const
+  {
+    return active &&
+	   lookup_props == lookup_props_ &&
+	   rewinds == buffer->rewinds;
+  }
+
+  /* Moves *i to the first glyph in [*i, limit) that is not skipped.
+   * Returns false, with *i at limit - 1, if there is none. */
+  inline bool next_kept (unsigned int *i, unsigned int limit)
+  {
+    unsigned int j = *i;
+    while (j < limit)
+    {
+      unsigned int block = j >> 5;
+      uint32_t bit = 1u << (j & 31);
+      if (!(known[block] & bit))
+	check (j);
+      if (!(skip[block] & bit))
+      {
+	*i = j;
+	return true;
+      }
+      uint32_t run = (known[block] & skip[block]) >> (j & 31);
+      j += ~run ? hb_ctz (~run) : 32;
+    }
+    *i = limit - 1;
+    return false;
+  }
+
+  /* Moves *i to the last glyph in [lower, *i] that is not skipped.
+   * Returns false, with *i at lower, if there is none. */
+  inline bool prev_kept (unsigned int *i, unsigned int lower)
+  {
+    int j = *i;
+    while (j >= (int) lower)
+    {
+      unsigned int block = j >> 5;
+      uint32_t bit = 1u << (j & 31);
+      if (!(known[block] & bit))
+	check (j);
+      if (!(skip[block] & bit))
+      {
+	*i = j;
+	return true;
+      }
+      uint32_t run = (known[block] & skip[block]) << (31 - (j & 31));
+      j -= 32 - hb_bit_storage (~run);
+    }
+    *i = lower;
+    return false;
+  }
+
+  private:
+  inline void check (unsigned int i);
+
+  const hb_ot_apply_context_t *c;
+  unsigned int lookup_props;
+  unsigned int rewinds;
+  bool active;
+  unsigned int scratch_offset; /* Of the bits; what is before is in use. */
+  uint32_t *known;
+  uint32_t *skip;
+};
+
 struct hb_ot_apply_context_t :
        hb_dispatch_context_t<hb_ot_apply_context_t, bool, HB_DEBUG_APPLY>
 {
@@ -318,6 +716,13 @@ struct hb_ot_apply_context_t :
       if (!c->check_glyph_property (&info, lookup_props))
 	return SKIP_YES;
 
+      return may_skip_ignorable (info);
+    }
+
+    /* may_skip() for a glyph known to pass check_glyph_property(). */
+    inline may_skip_t
+    may_skip_ignorable (const hb_glyph_info_t &info) const
+    {
       if (unlikely (_hb_glyph_info_is_default_ignorable_and_not_hidden (&info) &&
 		    (ignore_zwnj || !_hb_glyph_info_is_zwnj (&info)) &&
 		    (ignore_zwj || !_hb_glyph_info_is_zwj (&info))))
@@ -326,6 +731,8 @@ struct hb_ot_apply_context_t :
       return SKIP_NO;
     }
 
+    inline unsigned int get_lookup_props (void) const { return lookup_props; }
+
     protected:
     unsigned int lookup_props;
     bool ignore_zwnj;
@@ -382,6 +789,9 @@ struct hb_ot_apply_context_t :
     inline bool next (void)
     {
       assert (num_items > 0);
+      hb_skip_bits_t *skip_bits = c->get_skip_bits (matcher.get_lookup_props (), false);
+      if (unlikely (skip_bits))
+	return next (skip_bits);
       while (idx + num_items < end)
       {
 	idx++;
@@ -409,6 +819,9 @@ struct hb_ot_apply_context_t :
     inline bool prev (void)
     {
       assert (num_items > 0);
+      hb_skip_bits_t *skip_bits = c->get_skip_bits (matcher.get_lookup_props (), true);
+      if (unlikely (skip_bits))
+	return prev (skip_bits);
       while (idx > num_items - 1)
       {
 	idx--;
@@ -434,6 +847,59 @@ struct hb_ot_apply_context_t :
       return false;
     }
 
+    /* next() and prev() with the glyphs that check_glyph_property()
+     * rejects looked up in skip_bits. */
+    bool next (hb_skip_bits_t *skip_bits)
+    {
+      while (idx + num_items < end)
+      {
+	idx++;
+	if (!skip_bits->next_kept (&idx, end - num_items + 1))
+	  return false;
+	const hb_glyph_info_t &info = c->buffer->info[idx];
+
+	matcher_t::may_skip_t skip = matcher.may_skip_ignorable (info);
+	matcher_t::may_match_t match = matcher.may_match (info, match_glyph_data);
+	if (match == matcher_t::MATCH_YES ||
+	    (match == matcher_t::MATCH_MAYBE &&
+	     skip == matcher_t::SKIP_NO))
+	{
+	  num_items--;
+	  match_glyph_data++;
+	  return true;
+	}
+
+	if (skip == matcher_t::SKIP_NO)
+	  return false;
+      }
+      return false;
+    }
+    bool prev (hb_skip_bits_t *skip_bits)
+    {
+      while (idx > num_items - 1)
+      {
+	idx--;
+	if (!skip_bits->prev_kept (&idx, num_items - 1))
+	  return false;
+	const hb_glyph_info_t &info = c->buffer->out_info[idx];
+
+	matcher_t::may_skip_t skip = matcher.may_skip_ignorable (info);
+	matcher_t::may_match_t match = matcher.may_match (info, match_glyph_data);
+	if (match == matcher_t::MATCH_YES ||
+	    (match == matcher_t::MATCH_MAYBE &&
+	     skip == matcher_t::SKIP_NO))
+	{
+	  num_items--;
+	  match_glyph_data++;
+	  return true;
+	}
+
+	if (skip == matcher_t::SKIP_NO)
+	  return false;
+      }
+      return false;
+    }
+
     unsigned int idx;
     protected:
     hb_ot_apply_context_t *c;
@@ -486,6 +952,16 @@ struct hb_ot_apply_context_t :
 
   uint32_t random_state;
 
+  /* Of the subtable being applied through its lookup accelerator. */
+  const hb_class_cache_t *class_caches;
+  unsigned int num_class_caches;
+
+  /* For GPOS on long enough buffers; see hb_pair_cache_t. */
+  hb_pair_cache_t *pair_cache;
+
+  /* For the lookups hb_ot_map_t::apply() applies; see hb_skip_bits_t. */
+  hb_skip_bits_t *skip_bits;
+
 
   hb_ot_apply_context_t (unsigned int table_index_,
 		      hb_font_t *font_,
@@ -506,7 +982,35 @@ struct hb_ot_apply_context_t :
 			auto_zwnj (true),
 			auto_zwj (true),
 			random (false),
-			random_state (1) { init_iters (); }
+			random_state (1),
+			class_caches (nullptr),
+			num_class_caches (0),
+			pair_cache (nullptr),
+			skip_bits (nullptr) { init_iters (); }
+
+  /* Returns the cache for class_def if the current subtable has one;
+   * subtables applied through recursion don't. */
+  inline const hb_class_cache_t *get_class_cache (const ClassDef &class_def) const
+  {
+    for (unsigned int i = 0; i < num_class_caches; i++)
+      if (class_caches[i].class_def == &class_def)
+	return &class_caches[i];
+    return nullptr;
+  }
+  inline unsigned int get_class (const ClassDef &class_def, hb_codepoint_t glyph_id) const
+  {
+    const hb_class_cache_t *cache = get_class_cache (class_def);
+    return cache ? cache->get_class (glyph_id) : class_def.get_class (glyph_id);
+  }
+
+  inline hb_skip_bits_t *get_skip_bits (unsigned int match_props, bool backward) const
+  {
+    if (!skip_bits ||
+	(backward && table_index == 0) ||
+	!skip_bits->usable (match_props, buffer))
+      return nullptr;
+    return skip_bits;
+  }
 
   inline void init_iters (void)
   {
@@ -620,6 +1124,48 @@ struct hb_ot_apply_context_t :
   }
 };
 
+inline void
+hb_skip_bits_t::reset (const hb_ot_apply_context_t *c_, bool reverse)
+{
+  c = c_;
+  lookup_props = c->lookup_props;
+  rewinds = c->buffer->rewinds;
+  active = false;
+
+  /* A reverse lookup changes glyphs ahead of where it matches next.  And
+   * without a mark filtering set, check_glyph_property() is a few bit
+   * tests, no dearer than looking the bits up. */
+  if (reverse || !(lookup_props & LookupFlag::UseMarkFilteringSet))
+    return;
+
+  hb_buffer_t *buffer = c->buffer;
+  unsigned int size = scratch_offset + scratch_size (buffer->len);
+  /* Growing the scratch would move what is in use before the bits. */
+  if (scratch_offset && size > buffer->scratch_size)
+    return;
+  char *scratch = (char *) buffer->get_scratch (size);
+  if (unlikely (!scratch))
+    return;
+
+  unsigned int blocks = (buffer->len + 31) >> 5;
+  known = (uint32_t *) (scratch + scratch_offset);
+  skip = known + blocks;
+  memset (known, 0, blocks * sizeof (known[0]));
+  active = true;
+}
+
+inline void
+hb_skip_bits_t::check (unsigned int i)
+{
+  unsigned int block = i >> 5;
+  uint32_t bit = 1u << (i & 31);
+  if (c->check_glyph_property (&c->buffer->info[i], lookup_props))
+    skip[block] &= ~bit;
+  else
+    skip[block] |= bit;
+  known[block] |= bit;
+}
+
 
 struct hb_get_subtables_context_t :
        hb_dispatch_context_t<hb_get_subtables_context_t, hb_void_t, HB_DEBUG_APPLY>
@@ -636,23 +1182,62 @@ struct hb_get_subtables_context_t :
   struct hb_applicable_t
   {
     template <typename T>
-    inline void init (const T &obj_, hb_apply_func_t apply_func_)
+    inline void init (const T &obj_, hb_apply_func_t apply_func_, hb_accelerator_memory_t *memory)
     {
       obj = &obj_;
       apply_func = apply_func_;
       digest.init ();
       obj_.get_coverage ().add_coverage (&digest);
+      coverage.init (obj_.get_coverage (), memory);
+
+      class_caches = nullptr;
+      num_class_caches = 0;
+      const ClassDef *class_defs[3];
+      unsigned int count = get_class_defs (obj_, class_defs);
+      if (count)
+      {
+	class_caches = (hb_class_cache_t *) calloc (count, sizeof (class_caches[0]));
+	if (unlikely (!class_caches))
+	  return;
+	num_class_caches = count;
+	for (unsigned int i = 0; i < count; i++)
+	{
+	  class_caches[i].init (*class_defs[i]);
+	  /* Chain contexts often share one ClassDef between sequences;
+	   * get_class_cache() finds the first copy. */
+	  bool shared = false;
+	  for (unsigned int j = 0; j < i; j++)
+	    shared = shared || class_defs[j] == class_defs[i];
+	  if (!shared)
+	    class_caches[i].compile (memory);
+	}
+      }
+    }
+    inline void fini (void)
+    {
+      coverage.fini ();
+      for (unsigned int i = 0; i < num_class_caches; i++)
+	class_caches[i].fini ();
+      free (class_caches);
     }
 
     inline bool apply (OT::hb_ot_apply_context_t *c) const
     {
-      return digest.may_have (c->buffer->cur().codepoint) && apply_func (obj, c);
+      hb_codepoint_t g = c->buffer->cur().codepoint;
+      if (!digest.may_have (g) || !coverage.may_have (g))
+	return false;
+      c->class_caches = class_caches;
+      c->num_class_caches = num_class_caches;
+      return apply_func (obj, c);
     }
 
     private:
     const void *obj;
     hb_apply_func_t apply_func;
     hb_set_digest_t digest;
+    hb_coverage_bitmap_t coverage;
+    hb_class_cache_t *class_caches;
+    unsigned int num_class_caches;
   };
 
   typedef hb_vector_t<hb_applicable_t, 2> array_t;
@@ -663,17 +1248,20 @@ struct hb_get_subtables_context_t :
   inline return_t dispatch (const T &obj)
   {
     hb_applicable_t *entry = array.push();
-    entry->init (obj, apply_to<T>);
+    entry->init (obj, apply_to<T>, memory);
     return HB_VOID;
   }
   static return_t default_return_value (void) { return HB_VOID; }
   bool stop_sublookup_iteration (return_t r HB_UNUSED) const { return false; }
 
-  hb_get_subtables_context_t (array_t &array_) :
+  hb_get_subtables_context_t (array_t &array_,
+			      hb_accelerator_memory_t *memory_) :
 			      array (array_),
+			      memory (memory_),
 			      debug_depth (0) {}
 
   array_t &array;
+  hb_accelerator_memory_t *memory;
   unsigned int debug_depth;
 };
 
@@ -761,6 +1349,11 @@ static inline bool match_class (hb_codepoint_t glyph_id, const HBUINT16 &value,
   const ClassDef &class_def = *reinterpret_cast<const ClassDef *>(data);
   return class_def.get_class (glyph_id) == value;
 }
+static inline bool match_class_cached (hb_codepoint_t glyph_id, const HBUINT16 &value, const void *data)
+{
+  const hb_class_cache_t &class_cache = *reinterpret_cast<const hb_class_cache_t *>(data);
+  return class_cache.get_class (glyph_id) == value;
+}
 static inline bool match_coverage (hb_codepoint_t glyph_id, const HBUINT16 &value, const void *data)
 {
   const OffsetTo<Coverage> &coverage = (const OffsetTo<Coverage>&)value;
@@ -1628,15 +2221,23 @@ struct ContextFormat2
     if (likely (index == NOT_COVERED)) return_trace (false);
 
     const ClassDef &class_def = this+classDef;
-    index = class_def.get_class (c->buffer->cur().codepoint);
+    const hb_class_cache_t *class_cache = c->get_class_cache (class_def);
+    index = class_cache ? class_cache->get_class (c->buffer->cur().codepoint)
+			: class_def.get_class (c->buffer->cur().codepoint);
     const RuleSet &rule_set = this+ruleSet[index];
     struct ContextApplyLookupContext lookup_context = {
-      {match_class},
-      &class_def
+      {class_cache ? match_class_cached : match_class},
+      class_cache ? (const void *) class_cache : &class_def
     };
     return_trace (rule_set.apply (c, lookup_context));
   }
 
+  inline unsigned int get_class_defs (const ClassDef *class_defs[3]) const
+  {
+    class_defs[0] = &(this+classDef);
+    return 1;
+  }
+
   inline bool subset (hb_subset_context_t *c) const
   {
     TRACE_SUBSET (this);
@@ -1665,6 +2266,10 @@ struct ContextFormat2
   DEFINE_SIZE_ARRAY (8, ruleSet);
 };
 
+static inline unsigned int
+get_class_defs (const ContextFormat2 &obj, const ClassDef *class_defs[3])
+{ return obj.get_class_defs (class_defs); }
+
 
 struct ContextFormat3
 {
@@ -2310,6 +2915,23 @@ struct ChainContextFormat2
     const ClassDef &input_class_def = this+inputClassDef;
     const ClassDef &lookahead_class_def = this+lookaheadClassDef;
 
+    /* The three share one match func, so use the caches for all or none. */
+    const hb_class_cache_t *backtrack_class_cache = c->get_class_cache (backtrack_class_def);
+    const hb_class_cache_t *input_class_cache = c->get_class_cache (input_class_def);
+    const hb_class_cache_t *lookahead_class_cache = c->get_class_cache (lookahead_class_def);
+    if (backtrack_class_cache && input_class_cache && lookahead_class_cache)
+    {
+      index = input_class_cache->get_class (c->buffer->cur().codepoint);
+      const ChainRuleSet &rule_set = this+ruleSet[index];
+      struct ChainContextApplyLookupContext lookup_context = {
+	{match_class_cached},
+	{backtrack_class_cache,
+	 input_class_cache,
+	 lookahead_class_cache}
+      };
+      return_trace (rule_set.apply (c, lookup_context));
+    }
+
     index = input_class_def.get_class (c->buffer->cur().codepoint);
     const ChainRuleSet &rule_set = this+ruleSet[index];
     struct ChainContextApplyLookupContext lookup_context = {
@@ -2321,6 +2943,14 @@ struct ChainContextFormat2
     return_trace (rule_set.apply (c, lookup_context));
   }
 
+  inline unsigned int get_class_defs (const ClassDef *class_defs[3]) const
+  {
+    class_defs[0] = &(this+backtrackClassDef);
+    class_defs[1] = &(this+inputClassDef);
+    class_defs[2] = &(this+lookaheadClassDef);
+    return 3;
+  }
+
   inline bool subset (hb_subset_context_t *c) const
   {
     TRACE_SUBSET (this);
@@ -2362,6 +2992,10 @@ struct ChainContextFormat2
   DEFINE_SIZE_ARRAY (12, ruleSet);
 };
 
+static inline unsigned int
+get_class_defs (const ChainContextFormat2 &obj, const ClassDef *class_defs[3])
+{ return obj.get_class_defs (class_defs); }
+
 struct ChainContextFormat3
 {
   inline bool intersects (const hb_set_t *glyphs) const
@@ -2623,22 +3257,24 @@ struct Extension
 struct hb_ot_layout_lookup_accelerator_t
 {
   template <typename TLookup>
-  inline void init (const TLookup &lookup)
+  inline void init (const TLookup &lookup, hb_accelerator_memory_t *memory)
   {
     digest.init ();
     lookup.add_coverage (&digest);
 
     subtables.init ();
-    OT::hb_get_subtables_context_t c_get_subtables (subtables);
+    OT::hb_get_subtables_context_t c_get_subtables (subtables, memory);
     lookup.dispatch (&c_get_subtables);
   }
   inline void fini (void)
   {
-    subtables.fini ();
+    subtables.fini_deep ();
   }
 
   inline bool may_have (hb_codepoint_t g) const
   { return digest.may_have (g); }
+  inline bool may_have (const hb_set_digest_t &glyphs) const
+  { return digest.may_have (glyphs); }
 
   inline bool apply (hb_ot_apply_context_t *c) const
   {
@@ -2653,6 +3289,221 @@ struct hb_ot_layout_lookup_accelerator_t
   hb_get_subtables_context_t::array_t subtables;
 };
 
+/* For each glyph, the bitset of lookups whose coverage has it; that is,
+ * the lookups that may apply at that glyph.  hb_ot_map_t::apply() ORs
+ * together the rows of the glyphs in the buffer and skips the lookups
+ * that none of them can trigger, without scanning the buffer for each.
+ * Glyphs past the last one covered have no row, and no lookups.
+ *
+ * For GSUB there is also, for each lookup, the OR of the rows of the
+ * glyphs it or the lookups it calls may output, to bring that set up to
+ * date after the lookup applied without looking at the buffer again. */
+struct hb_lookup_index_t
+{
+  inline void init (void)
+  {
+    num_glyphs = 0;
+    num_words = 0;
+    rows = nullptr;
+    outputs = nullptr;
+    current = 0;
+  }
+  inline void fini (void)
+  {
+    free (rows);
+    free (outputs);
+    init ();
+  }
+
+  /* Leaves the index empty, so nothing is skipped, if the budget is
+   * spent. */
+  template <typename TTable>
+  inline void compile (const TTable &table,
+		       unsigned int lookup_count,
+		       hb_accelerator_memory_t *memory)
+  {
+    if (!lookup_count)
+      return;
+
+    hb_glyph_span_t span = {HB_SET_VALUE_INVALID, 0, 0};
+    for (unsigned int i = 0; i < lookup_count; i++)
+    {
+      hb_glyph_span_t lookup_span = {HB_SET_VALUE_INVALID, 0, 0};
+      table.get_lookup (i).add_coverage (&lookup_span);
+      if (lookup_span.first <= lookup_span.last)
+	span.add_range (lookup_span.first, lookup_span.last);
+    }
+    if (span.first > span.last)
+      return;
+
+    unsigned int words = (lookup_count + 31) / 32;
+    unsigned int glyphs = span.last + 1;
+    if (words > HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET / sizeof (rows[0]) / glyphs)
+      return;
+    unsigned int size = glyphs * words * sizeof (rows[0]);
+    if (size > HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET - memory->index_bytes)
+      return;
+    rows = (uint32_t *) calloc (1, size);
+    if (unlikely (!rows))
+      return;
+    num_glyphs = glyphs;
+    num_words = words;
+
+    for (current = 0; current < lookup_count; current++)
+      table.get_lookup (current).add_coverage (this);
+    memory->index_bytes += size;
+
+    if (TTable::tableTag == HB_OT_TAG_GSUB)
+      compile_outputs (table, lookup_count, memory);
+  }
+
+  private:
+  static inline hb_void_t record_recurse (hb_collect_glyphs_context_t *c HB_UNUSED,
+					  unsigned int lookup_index HB_UNUSED)
+  { return HB_VOID; }
+
+  /* The nested lookups aren't collected into the output here, as the table
+   * this index belongs to isn't available to them yet; their outputs are
+   * merged in afterwards instead. */
+  template <typename TTable>
+  inline void compile_outputs (const TTable &table,
+			       unsigned int lookup_count,
+			       hb_accelerator_memory_t *memory)
+  {
+    if (lookup_count > HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET / sizeof (outputs[0]) / num_words)
+      return;
+    unsigned int size = lookup_count * num_words * sizeof (outputs[0]);
+    if (size > HB_OT_LAYOUT_LOOKUP_INDEX_BUDGET - memory->index_bytes)
+      return;
+    outputs = (uint32_t *) calloc (1, size);
+    hb_set_t *recursed = (hb_set_t *) calloc (lookup_count, sizeof (hb_set_t));
+    if (unlikely (!outputs || !recursed))
+    {
+      free (outputs);
+      outputs = nullptr;
+      free (recursed);
+      return;
+    }
+
+    hb_set_t glyphs;
+    glyphs.init ();
+    for (unsigned int i = 0; i < lookup_count; i++)
+    {
+      recursed[i].init ();
+      glyphs.clear ();
+      hb_collect_glyphs_context_t c (nullptr, nullptr, nullptr, nullptr, &glyphs);
+      c.set_recurse_func (record_recurse);
+      table.get_lookup (i).dispatch (&c);
+      recursed[i].union_ (c.recursed_lookups);
+
+      uint32_t *output = outputs + i * num_words;
+      hb_codepoint_t g = HB_SET_VALUE_INVALID;
+      while (glyphs.next (&g) && g < num_glyphs)
+	for (unsigned int j = 0; j < num_words; j++)
+	  output[j] |= rows[g * num_words + j];
+    }
+    glyphs.fini ();
+
+    /* Lookups only ever gain bits here, so this settles. */
+    bool changed;
+    do
+    {
+      changed = false;
+      for (unsigned int i = 0; i < lookup_count; i++)
+      {
+	uint32_t *output = outputs + i * num_words;
+	hb_codepoint_t r = HB_SET_VALUE_INVALID;
+	while (recursed[i].next (&r) && r < lookup_count)
+	  for (unsigned int j = 0; j < num_words; j++)
+	  {
+	    uint32_t v = output[j] | outputs[r * num_words + j];
+	    if (v != output[j])
+	    {
+	      output[j] = v;
+	      changed = true;
+	    }
+	  }
+      }
+    }
+    while (changed);
+
+    for (unsigned int i = 0; i < lookup_count; i++)
+      recursed[i].fini ();
+    free (recursed);
+    memory->index_bytes += size;
+  }
+  public:
+
+  inline unsigned int get_num_words (void) const { return num_words; }
+
+  /* Sets lookups, of get_num_words() words, to the lookups that may apply
+   * somewhere in buffer.  Returns false, leaving lookups alone, if the
+   * index is empty. */
+  inline bool collect (const hb_buffer_t *buffer, uint32_t *lookups) const
+  {
+    if (!rows)
+      return false;
+    memset (lookups, 0, num_words * sizeof (lookups[0]));
+    unsigned int count = buffer->len;
+    const hb_glyph_info_t *info = buffer->info;
+    for (unsigned int i = 0; i < count; i++)
+    {
+      hb_codepoint_t g = info[i].codepoint;
+      if (unlikely (g >= num_glyphs))
+        continue;
+      const uint32_t *row = rows + g * num_words;
+      for (unsigned int j = 0; j < num_words; j++)
+        lookups[j] |= row[j];
+    }
+    return true;
+  }
+
+  static inline bool has_lookup (const uint32_t *lookups, unsigned int lookup_index)
+  { return lookups[lookup_index >> 5] & (1u << (lookup_index & 31)); }
+
+  /* Adds to lookups those that may apply to what lookup_index output.
+   * Returns false if that isn't known, and lookups must be collected
+   * again. */
+  inline bool add_outputs (uint32_t *lookups, unsigned int lookup_index) const
+  {
+    if (!outputs)
+      return false;
+    const uint32_t *output = outputs + lookup_index * num_words;
+    for (unsigned int j = 0; j < num_words; j++)
+      lookups[j] |= output[j];
+    return true;
+  }
+
+  /* Set interface for Coverage::add_coverage(). */
+  inline bool add_range (hb_codepoint_t a, hb_codepoint_t b)
+  {
+    if (unlikely (a > b || b >= num_glyphs))
+      return false;
+    uint32_t *p = rows + a * num_words + (current >> 5);
+    uint32_t bit = 1u << (current & 31);
+    for (unsigned int n = b - a + 1; n; n--, p += num_words)
+      *p |= bit;
+    return true;
+  }
+  template <typename T>
+  inline bool add_sorted_array (const T *array, unsigned int count, unsigned int stride=sizeof(T))
+  {
+    for (unsigned int i = 0; i < count; i++)
+    {
+      add_range (*array, *array);
+      array = (const T *) (stride + (const char *) array);
+    }
+    return true;
+  }
+
+  private:
+  unsigned int num_glyphs;
+  unsigned int num_words;
+  uint32_t *rows;
+  uint32_t *outputs;
+  unsigned int current; /* Lookup being added, while compiling. */
+};
+
 struct GSUBGPOS
 {
   inline bool has_data (void) const { return version.to_int () != 0; }
@@ -2759,8 +3610,14 @@ struct GSUBGPOS
       if (unlikely (!this->accels))
         this->lookup_count = 0;
 
+      this->memory.coverage_bytes.set_relaxed (0);
+      this->memory.class_bytes = 0;
+      this->memory.index_bytes = 0;
       for (unsigned int i = 0; i < this->lookup_count; i++)
-	this->accels[i].init (table->get_lookup (i));
+	this->accels[i].init (table->get_lookup (i), &this->memory);
+
+      this->index.init ();
+      this->index.compile (*table, this->lookup_count, &this->memory);
     }
 
     inline void fini (void)
@@ -2768,6 +3625,7 @@ struct GSUBGPOS
       for (unsigned int i = 0; i < this->lookup_count; i++)
 	this->accels[i].fini ();
       free (this->accels);
+      this->index.fini ();
       hb_blob_destroy (this->blob);
     }
 
@@ -2775,6 +3633,8 @@ struct GSUBGPOS
     const T *table;
     unsigned int lookup_count;
     hb_ot_layout_lookup_accelerator_t *accels;
+    hb_lookup_index_t index;
+    hb_accelerator_memory_t memory;
   };
 
   protected:
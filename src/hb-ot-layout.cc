@@ -976,6 +976,27 @@ hb_ot_layout_lookup_would_substitute_fast (hb_face_t            *face,
   return l.would_apply (&c, &hb_ot_face_data (face)->GSUB->accels[lookup_index]);
 }
 
+void
+hb_ot_layout_get_accelerator_memory (hb_face_t    *face,
+				     hb_tag_t      table_tag,
+				     unsigned int *coverage_bytes /* OUT */,
+				     unsigned int *class_bytes /* OUT */,
+				     unsigned int *index_bytes /* OUT */)
+{
+  *coverage_bytes = *class_bytes = *index_bytes = 0;
+  if (unlikely (!hb_ot_shaper_face_data_ensure (face))) return;
+  const OT::hb_accelerator_memory_t *memory;
+  switch (table_tag)
+  {
+    case HB_OT_TAG_GSUB: memory = &hb_ot_face_data (face)->GSUB->memory; break;
+    case HB_OT_TAG_GPOS: memory = &hb_ot_face_data (face)->GPOS->memory; break;
+    default: return;
+  }
+  *coverage_bytes = memory->coverage_bytes.get_relaxed ();
+  *class_bytes = memory->class_bytes;
+  *index_bytes = memory->index_bytes;
+}
+
 void
 hb_ot_layout_substitute_start (hb_font_t    *font,
 			       hb_buffer_t  *buffer)
@@ -1253,10 +1274,12 @@ struct GSUBProxy
 
   GSUBProxy (hb_face_t *face) :
     table (*hb_ot_face_data (face)->GSUB->table),
-    accels (hb_ot_face_data (face)->GSUB->accels) {}
+    accels (hb_ot_face_data (face)->GSUB->accels),
+    index (hb_ot_face_data (face)->GSUB->index) {}
 
   const OT::GSUB &table;
   const OT::hb_ot_layout_lookup_accelerator_t *accels;
+  const OT::hb_lookup_index_t &index;
 };
 
 struct GPOSProxy
@@ -1267,10 +1290,12 @@ struct GPOSProxy
 
   GPOSProxy (hb_face_t *face) :
     table (*hb_ot_face_data (face)->GPOS->table),
-    accels (hb_ot_face_data (face)->GPOS->accels) {}
+    accels (hb_ot_face_data (face)->GPOS->accels),
+    index (hb_ot_face_data (face)->GPOS->index) {}
 
   const OT::GPOS &table;
   const OT::hb_ot_layout_lookup_accelerator_t *accels;
+  const OT::hb_lookup_index_t &index;
 };
 
 
@@ -1321,8 +1346,9 @@ apply_backward (OT::hb_ot_apply_context_t *c,
   return ret;
 }
 
+/* Returns whether the lookup applied anywhere. */
 template <typename Proxy>
-static inline void
+static inline bool
 apply_string (OT::hb_ot_apply_context_t *c,
 	      const typename Proxy::Lookup &lookup,
 	      const OT::hb_ot_layout_lookup_accelerator_t &accel)
@@ -1330,9 +1356,13 @@ apply_string (OT::hb_ot_apply_context_t *c,
   hb_buffer_t *buffer = c->buffer;
 
   if (unlikely (!buffer->len || !c->lookup_mask))
-    return;
+    return false;
 
   c->set_lookup_props (lookup.get_props ());
+  if (c->skip_bits)
+    c->skip_bits->reset (c, lookup.is_reverse ());
+
+  bool ret;
 
   if (likely (!lookup.is_reverse ()))
   {
@@ -1341,7 +1371,6 @@ apply_string (OT::hb_ot_apply_context_t *c,
       buffer->clear_output ();
     buffer->idx = 0;
 
-    bool ret;
     ret = apply_forward (c, accel);
     if (ret)
     {
@@ -1358,10 +1387,86 @@ apply_string (OT::hb_ot_apply_context_t *c,
       buffer->remove_output ();
     buffer->idx = buffer->len - 1;
 
-    apply_backward (c, accel);
+    ret = apply_backward (c, accel);
   }
+  return ret;
 }
 
+/* Tracks which lookups may apply somewhere in the buffer, so that
+ * hb_ot_map_t::apply() can skip the rest without running them.  Uses the
+ * table's glyph-to-lookups index if it has one, and a digest of the
+ * glyphs in the buffer otherwise.
+ *
+ * GPOS doesn't change glyphs.  A GSUB lookup that applied adds what may
+ * apply to its output, if the index knows that; if not, or after a pause
+ * function, the buffer is looked at again, but only once a lookup is
+ * about to be skipped. */
+template <typename Proxy>
+struct hb_ot_lookup_filter_t
+{
+  hb_ot_lookup_filter_t (const Proxy &proxy_, const hb_buffer_t *buffer_) :
+			 proxy (proxy_),
+			 buffer (buffer_),
+			 stale (false)
+  {
+    candidates.init ();
+    use_index = candidates.resize (proxy.index.get_num_words ()) &&
+		proxy.index.collect (buffer, candidates.arrayZ ());
+    /* The digest is only made once the first lookup asks. */
+    digest.init ();
+    stale = !use_index;
+  }
+  ~hb_ot_lookup_filter_t (void) { candidates.fini (); }
+
+  inline bool may_apply (unsigned int lookup_index)
+  {
+    if (check (lookup_index))
+      return true;
+    if (!stale)
+      return false;
+    if (use_index)
+      proxy.index.collect (buffer, candidates.arrayZ ());
+    else
+      collect_digest ();
+    stale = false;
+    return check (lookup_index);
+  }
+
+  inline void applied (unsigned int lookup_index)
+  {
+    if (Proxy::inplace)
+      return;
+    if (!use_index || !proxy.index.add_outputs (candidates.arrayZ (), lookup_index))
+      stale = true;
+  }
+
+  inline void changed (void) { stale = true; }
+
+  private:
+  inline bool check (unsigned int lookup_index) const
+  {
+    return use_index ?
+	   OT::hb_lookup_index_t::has_lookup (candidates.arrayZ (), lookup_index) :
+	   proxy.accels[lookup_index].may_have (digest);
+  }
+
+  inline void collect_digest (void)
+  {
+    digest.init ();
+    unsigned int count = buffer->len;
+    const hb_glyph_info_t *info = buffer->info;
+    for (unsigned int i = 0; i < count; i++)
+      digest.add (info[i].codepoint);
+  }
+
+  const Proxy &proxy;
+  const hb_buffer_t *buffer;
+  bool use_index;
+  bool stale;
+  hb_vector_t<uint32_t, 16> candidates;
+  hb_set_digest_t digest;
+};
+
 template <typename Proxy>
 inline void hb_ot_map_t::apply (const Proxy &proxy,
 				const hb_ot_shape_plan_t *plan,
@@ -1372,6 +1477,26 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
   unsigned int i = 0;
   OT::hb_ot_apply_context_t c (table_index, font, buffer);
   c.set_recurse_func (Proxy::Lookup::apply_recurse_func);
+  hb_ot_lookup_filter_t<Proxy> filter (proxy, buffer);
+
+  /* The pair cache and the skip bits share the buffer's scratch memory.
+   * GPOS doesn't change the buffer length, so the room the skip bits will
+   * want is known, and is taken along with the cache's. */
+  unsigned int scratch_used = 0;
+  if (Proxy::table_index == 1 && buffer->len >= OT::hb_pair_cache_t::MIN_LEN)
+  {
+    c.pair_cache = (OT::hb_pair_cache_t *) buffer->get_scratch (sizeof (OT::hb_pair_cache_t) +
+								 OT::hb_skip_bits_t::scratch_size (buffer->len));
+    if (likely (c.pair_cache))
+    {
+      c.pair_cache->init ();
+      scratch_used = sizeof (OT::hb_pair_cache_t);
+    }
+  }
+
+  OT::hb_skip_bits_t skip_bits;
+  skip_bits.init (scratch_used);
+  c.skip_bits = &skip_bits;
 
   for (unsigned int stage_index = 0; stage_index < stages[table_index].len; stage_index++) {
     const stage_map_t *stage = &stages[table_index][stage_index];
@@ -1388,9 +1513,20 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
 	c.set_random (true);
 	buffer->unsafe_to_break_all ();
       }
-      apply_string<Proxy> (&c,
-			   proxy.table.get_lookup (lookup_index),
-			   proxy.accels[lookup_index]);
+      if (filter.may_apply (lookup_index))
+      {
+	if (buffer->profiling ())
+	  buffer->profile_lookups_run++;
+	hb_buffer_profile_scope_t profile (buffer, font, HB_BUFFER_PROFILE_STAGE_LOOKUP,
+					   table_index ? HB_OT_TAG_GPOS : HB_OT_TAG_GSUB,
+					   lookup_index);
+	if (apply_string<Proxy> (&c,
+				 proxy.table.get_lookup (lookup_index),
+				 proxy.accels[lookup_index]))
+	  filter.applied (lookup_index);
+      }
+      else if (buffer->profiling ())
+	buffer->profile_lookups_skipped++;
       (void) buffer->message (font, "end lookup %d", lookup_index);
     }
 
@@ -1398,6 +1534,7 @@ inline void hb_ot_map_t::apply (const Proxy &proxy,
     {
       buffer->clear_output ();
       stage->pause_func (plan, font, buffer);
+      filter.changed ();
     }
   }
 }
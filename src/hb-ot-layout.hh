@@ -106,6 +106,18 @@ hb_ot_layout_lookup_would_substitute_fast (hb_face_t            *face,
 					   hb_bool_t             zero_context);
 
 
+/* Bytes the GSUB or GPOS lookup accelerators of face spend on compiled
+ * coverage bitmaps and class arrays, and on the glyph-to-lookups index;
+ * builds the accelerators if needed.  Coverage bitmaps are only compiled
+ * as shaping first uses them. */
+HB_INTERNAL void
+hb_ot_layout_get_accelerator_memory (hb_face_t    *face,
+				     hb_tag_t      table_tag,
+				     unsigned int *coverage_bytes /* OUT */,
+				     unsigned int *class_bytes /* OUT */,
+				     unsigned int *index_bytes /* OUT */);
+
+
 /* Should be called before all the substitute_lookup's are done. */
 HB_INTERNAL void
 hb_ot_layout_substitute_start (hb_font_t    *font,
@@ -206,19 +218,21 @@ enum hb_unicode_props_flags_t {
 };
 HB_MARK_AS_FLAG_T (hb_unicode_props_flags_t);
 
+/* For when the general category is already known. */
 static inline void
-_hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
+_hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer,
+				  unsigned int gen_cat)
 {
   hb_unicode_funcs_t *unicode = buffer->unicode;
   unsigned int u = info->codepoint;
-  unsigned int gen_cat = (unsigned int) unicode->general_category (u);
+  unsigned int packed = _hb_unicode_props (u);
   unsigned int props = gen_cat;
 
   if (u >= 0x80)
   {
     buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_NON_ASCII;
 
-    if (unlikely (unicode->is_default_ignorable (u)))
+    if (unlikely (packed & HB_UNICODE_PROPS_IGNORABLE))
     {
       buffer->scratch_flags |= HB_BUFFER_SCRATCH_FLAG_HAS_DEFAULT_IGNORABLES;
       props |=  UPROPS_MASK_IGNORABLE;
@@ -254,6 +268,17 @@ _hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
   info->unicode_props() = props;
 }
 
+static inline void
+_hb_glyph_info_set_unicode_props (hb_glyph_info_t *info, hb_buffer_t *buffer)
+{
+  hb_unicode_funcs_t *unicode = buffer->unicode;
+  unsigned int u = info->codepoint;
+  _hb_glyph_info_set_unicode_props (info, buffer,
+				    likely (unicode->has_props_table ()) ?
+				    _hb_unicode_props (u) & HB_UNICODE_PROPS_GEN_CAT :
+				    (unsigned int) unicode->general_category (u));
+}
+
 static inline void
 _hb_glyph_info_set_general_category (hb_glyph_info_t *info,
 				     hb_unicode_general_category_t gen_cat)
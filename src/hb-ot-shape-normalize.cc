@@ -334,18 +334,24 @@ _hb_ot_shape_normalize (const hb_ot_shape_plan_t *plan,
       if (end < count)
 	end--; /* Leave one base for the marks to cluster with. */
 
-      /* From idx to end are simple clusters. */
-      if (might_short_circuit)
-      {
-        unsigned int done = font->get_nominal_glyphs (end - buffer->idx,
-						      &buffer->cur().codepoint,
-						      sizeof (buffer->info[0]),
-						      &buffer->cur().glyph_index(),
-						      sizeof (buffer->info[0]));
-	buffer->next_glyphs (done);
-      }
+      /* From idx to end are simple clusters.  Look them up in bulk, and
+       * after each character the font does not have, resume the bulk
+       * lookup after it. */
       while (buffer->idx < end && buffer->successful)
+      {
+	if (might_short_circuit)
+	{
+	  unsigned int done = font->get_nominal_glyphs (end - buffer->idx,
+							&buffer->cur().codepoint,
+							sizeof (buffer->info[0]),
+							&buffer->cur().glyph_index(),
+							sizeof (buffer->info[0]));
+	  buffer->next_glyphs (done);
+	  if (buffer->idx == end)
+	    break;
+	}
 	decompose_current_character (&c, might_short_circuit);
+      }
 
       if (buffer->idx == count || !buffer->successful)
 	break;
@@ -344,9 +344,29 @@ hb_set_unicode_props (hb_buffer_t *buffer)
    */
   unsigned int count = buffer->len;
   hb_glyph_info_t *info = buffer->info;
+
+  /* Without the built-in table, look up general categories a chunk at
+   * a time, saving a callback per character. */
+  bool batch = !buffer->unicode->has_props_table ();
+  hb_unicode_general_category_t gen_cats[64];
+  unsigned int chunk_start = 0, chunk_end = 0;
+
   for (unsigned int i = 0; i < count; i++)
   {
-    _hb_glyph_info_set_unicode_props (&info[i], buffer);
+    if (batch)
+    {
+      if (i >= chunk_end)
+      {
+	chunk_start = i;
+	chunk_end = MIN (count, i + (unsigned int) ARRAY_LENGTH (gen_cats));
+	buffer->unicode->general_categories (chunk_end - chunk_start,
+					     &info[i].codepoint, sizeof (info[0]),
+					     gen_cats, sizeof (gen_cats[0]));
+      }
+      _hb_glyph_info_set_unicode_props (&info[i], buffer, gen_cats[i - chunk_start]);
+    }
+    else
+      _hb_glyph_info_set_unicode_props (&info[i], buffer);
 
     /* Marks are already set as continuation by the above line.
      * Handle Emoji_Modifier and ZWJ-continuation. */
@@ -687,9 +707,15 @@ hb_ot_substitute_default (const hb_ot_shape_context_t *c)
 
   HB_BUFFER_ALLOCATE_VAR (buffer, glyph_index);
 
-  _hb_ot_shape_normalize (c->plan, buffer, c->font);
+  {
+    hb_buffer_profile_scope_t profile (buffer, c->font, HB_BUFFER_PROFILE_STAGE_NORMALIZE);
+    _hb_ot_shape_normalize (c->plan, buffer, c->font);
+  }
 
-  hb_ot_shape_setup_masks (c);
+  {
+    hb_buffer_profile_scope_t profile (buffer, c->font, HB_BUFFER_PROFILE_STAGE_SETUP_MASKS);
+    hb_ot_shape_setup_masks (c);
+  }
 
   /* This is unfortunate to go here, but necessary... */
   if (c->plan->fallback_mark_positioning)
@@ -704,6 +730,7 @@ static inline void
 hb_ot_substitute_complex (const hb_ot_shape_context_t *c)
 {
   hb_buffer_t *buffer = c->buffer;
+  hb_buffer_profile_scope_t profile (buffer, c->font, HB_BUFFER_PROFILE_STAGE_SUBSTITUTE);
 
   hb_ot_layout_substitute_start (c->font, buffer);
 
@@ -873,12 +900,19 @@ hb_ot_position (const hb_ot_shape_context_t *c)
 {
   c->buffer->clear_positions ();
 
-  hb_ot_position_default (c);
+  {
+    hb_buffer_profile_scope_t profile (c->buffer, c->font, HB_BUFFER_PROFILE_STAGE_POSITION);
+
+    hb_ot_position_default (c);
 
-  hb_ot_position_complex (c);
+    hb_ot_position_complex (c);
+  }
 
   if (c->plan->fallback_mark_positioning && c->plan->shaper->fallback_position)
+  {
+    hb_buffer_profile_scope_t profile (c->buffer, c->font, HB_BUFFER_PROFILE_STAGE_FALLBACK);
     _hb_ot_shape_fallback_mark_position (c->plan, c->font, c->buffer);
+  }
 
   if (HB_DIRECTION_IS_BACKWARD (c->buffer->props.direction))
     hb_buffer_reverse (c->buffer);
@@ -886,9 +920,15 @@ hb_ot_position (const hb_ot_shape_context_t *c)
   /* Visual fallback goes here. */
 
   if (c->plan->apply_kern)
+  {
+    hb_buffer_profile_scope_t profile (c->buffer, c->font, HB_BUFFER_PROFILE_STAGE_KERN);
     hb_ot_layout_kern (c->font, c->buffer, c->plan->kern_mask);
+  }
   else if (c->plan->fallback_kerning)
+  {
+    hb_buffer_profile_scope_t profile (c->buffer, c->font, HB_BUFFER_PROFILE_STAGE_FALLBACK);
     _hb_ot_shape_fallback_kern (c->plan, c->font, c->buffer);
+  }
 
   _hb_buffer_deallocate_gsubgpos_vars (c->buffer);
 }
@@ -958,7 +998,10 @@ hb_ot_shape_internal (hb_ot_shape_context_t *c)
   hb_ot_substitute (c);
   hb_ot_position (c);
 
-  hb_ot_hide_default_ignorables (c);
+  {
+    hb_buffer_profile_scope_t profile (c->buffer, c->font, HB_BUFFER_PROFILE_STAGE_HIDE_DEFAULT_IGNORABLES);
+    hb_ot_hide_default_ignorables (c);
+  }
 
   if (c->plan->shaper->postprocess_glyphs)
     c->plan->shaper->postprocess_glyphs (c->plan, c->buffer, c->font);
@@ -115,10 +115,10 @@ struct HVARVVAR
   }
 
   inline float get_advance_var (hb_codepoint_t glyph,
-				int *coords, unsigned int coord_count) const
+				hb_font_t *font) const
   {
     unsigned int varidx = (this+advMap).map (glyph);
-    return (this+varStore).get_delta (varidx, coords, coord_count);
+    return (this+varStore).get_delta (varidx, font);
   }
 
   inline bool has_sidebearing_deltas (void) const
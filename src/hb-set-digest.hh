@@ -106,6 +106,12 @@ struct hb_set_digest_lowest_bits_t
     return !!(mask & mask_for (g));
   }
 
+  /* Whether the sets the two digests stand for may have a glyph in
+   * common. */
+  inline bool may_have (const hb_set_digest_lowest_bits_t &o) const {
+    return !!(mask & o.mask);
+  }
+
   private:
 
   static inline mask_t mask_for (hb_codepoint_t g) {
@@ -152,6 +158,10 @@ struct hb_set_digest_combiner_t
     return head.may_have (g) && tail.may_have (g);
   }
 
+  inline bool may_have (const hb_set_digest_combiner_t &o) const {
+    return head.may_have (o.head) && tail.may_have (o.tail);
+  }
+
   private:
   head_t head;
   tail_t tail;
@@ -30,6 +30,99 @@
 #include "hb.hh"
 
 
+/*
+ * Page kernels
+ *
+ * The bulk operations on the eight 64-bit words of an hb_set_t page, a
+ * word at a time.  Where hb.hh enables SSE2, the kernels the compiler
+ * doesn't do as well by itself are replaced with ones going two words at
+ * a time.  Those load unaligned, since hb_vector_t does not align pages
+ * beyond what malloc() gives it.
+ */
+
+struct hb_set_page_generic_t
+{
+  typedef unsigned long long elt_t;
+  enum { ELTS = 8 };
+
+  template <class Op>
+  static inline void process (elt_t *o, const elt_t *a, const elt_t *b)
+  {
+    for (unsigned int i = 0; i < ELTS; i++)
+      Op::process (o[i], a[i], b[i]);
+  }
+
+  static inline bool is_empty (const elt_t *v)
+  {
+    for (unsigned int i = 0; i < ELTS; i++)
+      if (v[i])
+	return false;
+    return true;
+  }
+
+  static inline unsigned int get_population (const elt_t *v)
+  {
+    unsigned int pop = 0;
+    for (unsigned int i = 0; i < ELTS; i++)
+      pop += hb_popcount (v[i]);
+    return pop;
+  }
+
+  /* Bit i of the result is set if word i is non-zero. */
+  static inline unsigned int nonzero_words (const elt_t *v)
+  {
+    unsigned int words = 0;
+    for (unsigned int i = 0; i < ELTS; i++)
+      words |= (unsigned int) !!v[i] << i;
+    return words;
+  }
+};
+
+#ifdef HB_SIMD_SSE2
+struct hb_set_page_sse2_t : hb_set_page_generic_t
+{
+  static inline __m128i load (const elt_t *v, unsigned int i)
+  { return _mm_loadu_si128 ((const __m128i *) (v + 2 * i)); }
+
+#ifndef __POPCNT__
+  /* With the popcnt instruction, the generic kernel is faster. */
+  static inline unsigned int get_population (const elt_t *v)
+  {
+    const __m128i m1 = _mm_set1_epi8 (0x55);
+    const __m128i m2 = _mm_set1_epi8 (0x33);
+    const __m128i m4 = _mm_set1_epi8 (0x0F);
+    __m128i sum = _mm_setzero_si128 ();
+    for (unsigned int i = 0; i < ELTS / 2; i++)
+    {
+      /* Per-byte counts, at most 8 each; their sum over the page fits a byte. */
+      __m128i x = load (v, i);
+      x = _mm_sub_epi8 (x, _mm_and_si128 (_mm_srli_epi64 (x, 1), m1));
+      x = _mm_add_epi8 (_mm_and_si128 (x, m2), _mm_and_si128 (_mm_srli_epi64 (x, 2), m2));
+      x = _mm_and_si128 (_mm_add_epi8 (x, _mm_srli_epi64 (x, 4)), m4);
+      sum = _mm_add_epi8 (sum, x);
+    }
+    sum = _mm_sad_epu8 (sum, _mm_setzero_si128 ());
+    return _mm_cvtsi128_si32 (sum) + _mm_cvtsi128_si32 (_mm_srli_si128 (sum, 8));
+  }
+#endif
+
+  static inline unsigned int nonzero_words (const elt_t *v)
+  {
+    unsigned int zero = 0;
+    for (unsigned int i = 0; i < ELTS / 2; i++)
+    {
+      /* A word is zero if both its halves are; movemask_pd then picks up
+       * the sign bit of each word. */
+      __m128i x = _mm_cmpeq_epi32 (load (v, i), _mm_setzero_si128 ());
+      x = _mm_and_si128 (x, _mm_shuffle_epi32 (x, _MM_SHUFFLE (2, 3, 0, 1)));
+      zero |= (unsigned int) _mm_movemask_pd (_mm_castsi128_pd (x)) << (2 * i);
+    }
+    return ~zero & ((1u << ELTS) - 1);
+  }
+};
+#endif
+
+
 /*
  * hb_set_t
  */
@@ -55,13 +148,7 @@ struct hb_set_t
     inline unsigned int len (void) const
     { return ARRAY_LENGTH_CONST (v); }
 
-    inline bool is_empty (void) const
-    {
-      for (unsigned int i = 0; i < len (); i++)
-        if (v[i])
-	  return false;
-      return true;
-    }
+    inline bool is_empty (void) const { return ops_t::is_empty (&v[0]); }
 
     inline void add (hb_codepoint_t g) { elt (g) |= mask (g); }
     inline void del (hb_codepoint_t g) { elt (g) &= ~mask (g); }
@@ -89,13 +176,11 @@ struct hb_set_t
       return 0 == memcmp (&v, &other->v, sizeof (v));
     }
 
-    inline unsigned int get_population (void) const
-    {
-      unsigned int pop = 0;
-      for (unsigned int i = 0; i < len (); i++)
-        pop += hb_popcount (v[i]);
-      return pop;
-    }
+    template <class Op>
+    inline void process (const page_t &a, const page_t &b)
+    { ops_t::template process<Op> (&v[0], &a.v[0], &b.v[0]); }
+
+    inline unsigned int get_population (void) const { return ops_t::get_population (&v[0]); }
 
     inline bool next (hb_codepoint_t *codepoint) const
     {
@@ -109,15 +194,21 @@ struct hb_set_t
       unsigned int j = m & ELT_MASK;
 
       const elt_t vv = v[i] & ~((elt_t (1) << j) - 1);
-      for (const elt_t *p = &vv; i < len (); p = &v[++i])
-	if (*p)
-	{
-	  *codepoint = i * ELT_BITS + elt_get_min (*p);
-	  return true;
-	}
+      if (vv)
+      {
+	*codepoint = i * ELT_BITS + elt_get_min (vv);
+	return true;
+      }
 
-      *codepoint = INVALID;
-      return false;
+      unsigned int words = ops_t::nonzero_words (&v[0]) & ~((2u << i) - 1);
+      if (!words)
+      {
+	*codepoint = INVALID;
+	return false;
+      }
+      i = hb_ctz (words);
+      *codepoint = i * ELT_BITS + elt_get_min (v[i]);
+      return true;
     }
     inline bool previous (hb_codepoint_t *codepoint) const
     {
@@ -130,30 +221,65 @@ struct hb_set_t
       unsigned int i = m / ELT_BITS;
       unsigned int j = m & ELT_MASK;
 
-      const elt_t vv = v[i] & ((elt_t (1) << (j + 1)) - 1);
-      for (const elt_t *p = &vv; (int) i >= 0; p = &v[--i])
-	if (*p)
-	{
-	  *codepoint = i * ELT_BITS + elt_get_max (*p);
-	  return true;
-	}
+      const elt_t vv = v[i] & ((elt_t (2) << j) - 1);
+      if (vv)
+      {
+	*codepoint = i * ELT_BITS + elt_get_max (vv);
+	return true;
+      }
 
-      *codepoint = INVALID;
-      return false;
+      unsigned int words = ops_t::nonzero_words (&v[0]) & ((1u << i) - 1);
+      if (!words)
+      {
+	*codepoint = INVALID;
+	return false;
+      }
+      i = hb_bit_storage (words) - 1;
+      *codepoint = i * ELT_BITS + elt_get_max (v[i]);
+      return true;
     }
     inline hb_codepoint_t get_min (void) const
     {
-      for (unsigned int i = 0; i < len (); i++)
-        if (v[i])
-	  return i * ELT_BITS + elt_get_min (v[i]);
-      return INVALID;
+      unsigned int words = ops_t::nonzero_words (&v[0]);
+      if (!words)
+        return INVALID;
+      unsigned int i = hb_ctz (words);
+      return i * ELT_BITS + elt_get_min (v[i]);
     }
     inline hb_codepoint_t get_max (void) const
     {
-      for (int i = len () - 1; i >= 0; i--)
-        if (v[i])
-	  return i * ELT_BITS + elt_get_max (v[i]);
-      return 0;
+      unsigned int words = ops_t::nonzero_words (&v[0]);
+      if (!words)
+        return INVALID;
+      unsigned int i = hb_bit_storage (words) - 1;
+      return i * ELT_BITS + elt_get_max (v[i]);
+    }
+
+    /* The last and first bits of the run of set bits through g, which is
+     * set; MASK and 0 if the run reaches the end of the page. */
+    inline unsigned int run_end (hb_codepoint_t g) const
+    {
+      unsigned int i = (g & MASK) / ELT_BITS;
+      elt_t w = ~v[i] & ~((elt_t (1) << (g & ELT_MASK)) - 1);
+      while (!w)
+      {
+	if (++i == len ())
+	  return MASK;
+	w = ~v[i];
+      }
+      return i * ELT_BITS + hb_ctz (w) - 1;
+    }
+    inline unsigned int run_start (hb_codepoint_t g) const
+    {
+      unsigned int i = (g & MASK) / ELT_BITS;
+      elt_t w = ~v[i] & ((elt_t (2) << (g & ELT_MASK)) - 1);
+      while (!w)
+      {
+	if (!i--)
+	  return 0;
+	w = ~v[i];
+      }
+      return i * ELT_BITS + hb_bit_storage (w);
     }
 
     typedef unsigned long long elt_t;
@@ -165,6 +291,13 @@ struct hb_set_t
 
     typedef hb_vector_size_t<elt_t, PAGE_BITS / 8> vector_t;
 
+#if defined(HB_SIMD_SSE2)
+    typedef hb_set_page_sse2_t ops_t;
+#else
+    typedef hb_set_page_generic_t ops_t;
+#endif
+    static_assert ((unsigned) ops_t::ELTS * sizeof (elt_t) == sizeof (vector_t), "");
+
     enum { ELT_BITS = sizeof (elt_t) * 8 };
     enum { ELT_MASK = ELT_BITS - 1 };
     enum { BITS = sizeof (vector_t) * 8 };
@@ -179,18 +312,35 @@ struct hb_set_t
   };
   static_assert (page_t::PAGE_BITS == sizeof (page_t) * 8, "");
 
+  /* A set that is mostly long runs, like all of Unicode but a few
+   * codepoints or a large contiguous glyph range, is held as a sorted list
+   * of disjoint, non-adjacent ranges instead of pages.  add_range() moves
+   * a set with few ranges to that form when the new run would fill many
+   * pages; anything that takes it past MAX_RANGES moves it back. */
+  struct range_t
+  {
+    hb_codepoint_t first;
+    hb_codepoint_t last;
+  };
+  enum { MAX_RANGES = 256 };
+  enum { RANGE_MIN_PAGES = 8 };
+
   hb_object_header_t header;
   bool successful; /* Allocations successful */
+  bool in_ranges; /* Held in ranges, not pages and page_map */
   mutable unsigned int population;
   hb_vector_t<page_map_t, 1> page_map;
   hb_vector_t<page_t, 1> pages;
+  hb_vector_t<range_t, 1> ranges;
 
   inline void init_shallow (void)
   {
     successful = true;
+    in_ranges = false;
     population = 0;
     page_map.init ();
     pages.init ();
+    ranges.init ();
   }
   inline void init (void)
   {
@@ -201,6 +351,7 @@ struct hb_set_t
   {
     page_map.fini ();
     pages.fini ();
+    ranges.fini ();
   }
   inline void fini (void)
   {
@@ -224,11 +375,15 @@ struct hb_set_t
     if (unlikely (hb_object_is_inert (this)))
       return;
     successful = true;
+    in_ranges = false;
     population = 0;
     page_map.resize (0);
     pages.resize (0);
+    ranges.resize (0);
   }
   inline bool is_empty (void) const {
+    if (in_ranges)
+      return !ranges.len;
     unsigned int count = pages.len;
     for (unsigned int i = 0; i < count; i++)
       if (!pages[i].is_empty ())
@@ -243,6 +398,11 @@ struct hb_set_t
     if (unlikely (!successful)) return;
     if (unlikely (g == INVALID)) return;
     dirty ();
+    if (in_ranges)
+    {
+      ranges_add (g, g);
+      return;
+    }
     page_t *page = page_for_insert (g); if (unlikely (!page)) return;
     page->add (g);
   }
@@ -251,6 +411,16 @@ struct hb_set_t
     if (unlikely (!successful)) return true; /* https://github.com/harfbuzz/harfbuzz/issues/657 */
     if (unlikely (a > b || a == INVALID || b == INVALID)) return false;
     dirty ();
+    if (in_ranges ||
+	(get_major (b) - get_major (a) > RANGE_MIN_PAGES && to_ranges ()))
+    {
+      ranges_add (a, b);
+      return true;
+    }
+    return pages_add_range (a, b);
+  }
+  inline bool pages_add_range (hb_codepoint_t a, hb_codepoint_t b)
+  {
     unsigned int ma = get_major (a);
     unsigned int mb = get_major (b);
     if (ma == mb)
@@ -281,6 +451,12 @@ struct hb_set_t
     if (unlikely (!successful)) return;
     if (!count) return;
     dirty ();
+    for (; in_ranges && count; count--)
+    {
+      add (*array);
+      array = (const T *) ((const char *) array + stride);
+    }
+    if (!count) return;
     hb_codepoint_t g = *array;
     while (count)
     {
@@ -309,6 +485,16 @@ struct hb_set_t
     dirty ();
     hb_codepoint_t g = *array;
     hb_codepoint_t last_g = g;
+    for (; in_ranges && count; count--)
+    {
+      g = *array;
+      if (g < last_g) return false;
+      last_g = g;
+      add (g);
+      array = (const T *) ((const char *) array + stride);
+    }
+    if (!count) return true;
+    g = *array;
     while (count)
     {
       unsigned int m = get_major (g);
@@ -334,6 +520,12 @@ struct hb_set_t
   {
     /* TODO perform op even if !successful. */
     if (unlikely (!successful)) return;
+    if (in_ranges)
+    {
+      dirty ();
+      ranges_del (g, g);
+      return;
+    }
     page_t *p = page_for (g);
     if (!p)
       return;
@@ -345,11 +537,23 @@ struct hb_set_t
     /* TODO perform op even if !successful. */
     /* TODO Optimize, like add_range(). */
     if (unlikely (!successful)) return;
+    if (in_ranges)
+    {
+      if (unlikely (a > b || b == INVALID)) return;
+      dirty ();
+      ranges_del (a, b);
+      return;
+    }
     for (unsigned int i = a; i < b + 1; i++)
       del (i);
   }
   inline bool has (hb_codepoint_t g) const
   {
+    if (in_ranges)
+    {
+      unsigned int i = range_bound (g);
+      return i < ranges.len && ranges[i].first <= g;
+    }
     const page_t *p = page_for (g);
     if (!p)
       return false;
@@ -364,9 +568,25 @@ struct hb_set_t
   inline void set (const hb_set_t *other)
   {
     if (unlikely (!successful)) return;
+    if (other->in_ranges)
+    {
+      if (!ranges.resize (other->ranges.len))
+      {
+	successful = false;
+	return;
+      }
+      memcpy (ranges.arrayZ(), other->ranges.arrayZ(), ranges.len * sizeof (ranges.arrayZ()[0]));
+      page_map.resize (0);
+      pages.resize (0);
+      in_ranges = true;
+      population = other->population;
+      return;
+    }
     unsigned int count = other->pages.len;
     if (!resize (count))
       return;
+    in_ranges = false;
+    ranges.resize (0);
     population = other->population;
     memcpy (pages.arrayZ(), other->pages.arrayZ(), count * sizeof (pages.arrayZ()[0]));
     memcpy (page_map.arrayZ(), other->page_map.arrayZ(), count * sizeof (page_map.arrayZ()[0]));
@@ -377,6 +597,17 @@ struct hb_set_t
     if (get_population () != other->get_population ())
       return false;
 
+    if (in_ranges || other->in_ranges)
+    {
+      hb_codepoint_t a_first = INVALID, a_last = INVALID;
+      hb_codepoint_t b_first = INVALID, b_last = INVALID;
+      while (next_range (&a_first, &a_last))
+	if (!other->next_range (&b_first, &b_last) ||
+	    a_first != b_first || a_last != b_last)
+	  return false;
+      return !other->next_range (&b_first, &b_last);
+    }
+
     unsigned int na = pages.len;
     unsigned int nb = other->pages.len;
 
@@ -404,6 +635,20 @@ struct hb_set_t
     if (get_population () > larger_set->get_population ())
       return false;
 
+    if (in_ranges || larger_set->in_ranges)
+    {
+      hb_codepoint_t first = INVALID, last = INVALID;
+      while (next_range (&first, &last))
+      {
+	/* The range of larger_set starting at or running through first. */
+	hb_codepoint_t larger_first, larger_last = first ? first - 1 : INVALID;
+	if (!larger_set->next_range (&larger_first, &larger_last) ||
+	    larger_first > first || larger_last < last)
+	  return false;
+      }
+      return true;
+    }
+
     /* TODO Optimize to use pages. */
     hb_codepoint_t c = INVALID;
     while (next (&c))
@@ -420,6 +665,26 @@ struct hb_set_t
 
     dirty ();
 
+    if (in_ranges || other->in_ranges)
+    {
+      if (process_ranges<Op> (other))
+	return;
+      if (in_ranges)
+	to_pages ();
+      if (other->in_ranges)
+      {
+	hb_set_t other_pages;
+	other_pages.init_shallow ();
+	other_pages.set (other);
+	other_pages.to_pages ();
+	process<Op> (&other_pages);
+	if (unlikely (!other_pages.successful))
+	  successful = false;
+	other_pages.fini_shallow ();
+	return;
+      }
+    }
+
     unsigned int na = pages.len;
     unsigned int nb = other->pages.len;
     unsigned int next_page = na;
@@ -468,7 +733,7 @@ struct hb_set_t
 	b--;
 	count--;
 	page_map[count] = page_map[a];
-	Op::process (page_at (count).v, page_at (a).v, other->page_at (b).v);
+	page_at (count).process<Op> (page_at (a), other->page_at (b));
       }
       else if (page_map[a - 1].major > other->page_map[b - 1].major)
       {
@@ -535,6 +800,19 @@ struct hb_set_t
       return *codepoint != INVALID;
     }
 
+    if (in_ranges)
+    {
+      hb_codepoint_t g = *codepoint + 1;
+      unsigned int i = range_bound (g);
+      if (g == INVALID || i == ranges.len)
+      {
+	*codepoint = INVALID;
+	return false;
+      }
+      *codepoint = MAX (g, ranges[i].first);
+      return true;
+    }
+
     page_map_t map = {get_major (*codepoint), 0};
     unsigned int i;
     page_map.bfind (map, &i);
@@ -566,6 +844,22 @@ struct hb_set_t
       return *codepoint != INVALID;
     }
 
+    if (in_ranges)
+    {
+      hb_codepoint_t g = *codepoint - 1;
+      unsigned int i = range_bound (g);
+      if (*codepoint && i < ranges.len && ranges[i].first <= g)
+	*codepoint = g;
+      else if (*codepoint && i)
+	*codepoint = ranges[i - 1].last;
+      else
+      {
+	*codepoint = INVALID;
+	return false;
+      }
+      return true;
+    }
+
     page_map_t map = {get_major (*codepoint), 0};
     unsigned int i;
     page_map.bfind (map, &i);
@@ -601,10 +895,29 @@ struct hb_set_t
       return false;
     }
 
-    /* TODO Speed up. */
-    *last = *first = i;
-    while (next (&i) && i == *last + 1)
-      (*last)++;
+    *first = i;
+    if (in_ranges)
+    {
+      *last = ranges[range_bound (i)].last;
+      return true;
+    }
+
+    /* Follow the run through consecutive pages. */
+    page_map_t map = {get_major (i), 0};
+    unsigned int k;
+    page_map.bfind (map, &k);
+    for (;;)
+    {
+      unsigned int end = page_at (k).run_end (i);
+      *last = major_start (page_map[k].major) + end;
+      if (end != page_t::MASK ||
+	  k + 1 == page_map.len ||
+	  page_map[k + 1].major != page_map[k].major + 1 ||
+	  !page_at (k + 1).has (0))
+	break;
+      k++;
+      i = major_start (page_map[k].major);
+    }
 
     return true;
   }
@@ -619,10 +932,29 @@ struct hb_set_t
       return false;
     }
 
-    /* TODO Speed up. */
-    *last = *first = i;
-    while (previous (&i) && i == *first - 1)
-      (*first)--;
+    *last = i;
+    if (in_ranges)
+    {
+      *first = ranges[range_bound (i)].first;
+      return true;
+    }
+
+    /* Follow the run back through consecutive pages. */
+    page_map_t map = {get_major (i), 0};
+    unsigned int k;
+    page_map.bfind (map, &k);
+    for (;;)
+    {
+      unsigned int start = page_at (k).run_start (i);
+      *first = major_start (page_map[k].major) + start;
+      if (start ||
+	  !k ||
+	  page_map[k - 1].major + 1 != page_map[k].major ||
+	  !page_at (k - 1).has (page_t::MASK))
+	break;
+      k--;
+      i = major_start (page_map[k].major) + page_t::MASK;
+    }
 
     return true;
   }
@@ -633,6 +965,9 @@ struct hb_set_t
       return population;
 
     unsigned int pop = 0;
+    if (in_ranges)
+      for (unsigned int i = 0; i < ranges.len; i++)
+	pop += ranges[i].last - ranges[i].first + 1;
     unsigned int count = pages.len;
     for (unsigned int i = 0; i < count; i++)
       pop += pages[i].get_population ();
@@ -642,6 +977,8 @@ struct hb_set_t
   }
   inline hb_codepoint_t get_min (void) const
   {
+    if (in_ranges)
+      return ranges.len ? ranges[0].first : INVALID;
     unsigned int count = pages.len;
     for (unsigned int i = 0; i < count; i++)
       if (!page_at (i).is_empty ())
@@ -650,8 +987,10 @@ struct hb_set_t
   }
   inline hb_codepoint_t get_max (void) const
   {
+    if (in_ranges)
+      return ranges.len ? ranges[ranges.len - 1].last : INVALID;
     unsigned int count = pages.len;
-    for (int i = count - 1; i >= 0; i++)
+    for (int i = count - 1; i >= 0; i--)
       if (!page_at (i).is_empty ())
         return page_map[i].major * page_t::PAGE_BITS + page_at (i).get_max ();
     return INVALID;
@@ -694,6 +1033,237 @@ struct hb_set_t
   inline const page_t &page_at (unsigned int i) const { return pages[page_map[i].index]; }
   inline unsigned int get_major (hb_codepoint_t g) const { return g / page_t::PAGE_BITS; }
   inline hb_codepoint_t major_start (unsigned int major) const { return major * page_t::PAGE_BITS; }
+
+  /* Range form. */
+
+  /* Index of the first range that ends at or after g. */
+  inline unsigned int range_bound (hb_codepoint_t g) const
+  {
+    const range_t *r = ranges.arrayZ();
+    unsigned int lo = 0, hi = ranges.len;
+    while (lo < hi)
+    {
+      unsigned int mid = (lo + hi) / 2;
+      if (r[mid].last < g)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return lo;
+  }
+  /* Replaces ranges [start, end) with count others. */
+  inline bool ranges_replace (unsigned int start, unsigned int end,
+			      const range_t *others, unsigned int count)
+  {
+    unsigned int len = ranges.len;
+    if (count > end - start && !ranges.resize (len + count - (end - start)))
+    {
+      successful = false;
+      return false;
+    }
+    range_t *r = ranges.arrayZ();
+    memmove (r + start + count, r + end, (len - end) * sizeof (r[0]));
+    memcpy (r + start, others, count * sizeof (r[0]));
+    ranges.shrink (len + count - (end - start));
+    if (ranges.len > MAX_RANGES)
+      to_pages ();
+    return true;
+  }
+  inline void ranges_add (hb_codepoint_t a, hb_codepoint_t b)
+  {
+    /* Merge with every range that overlaps or touches a..b. */
+    unsigned int start = range_bound (a ? a - 1 : 0);
+    unsigned int end = start;
+    while (end < ranges.len && ranges[end].first <= b + 1)
+      end++;
+    range_t r = {a, b};
+    if (start < end)
+    {
+      r.first = MIN (a, ranges[start].first);
+      r.last = MAX (b, ranges[end - 1].last);
+    }
+    ranges_replace (start, end, &r, 1);
+  }
+  inline void ranges_del (hb_codepoint_t a, hb_codepoint_t b)
+  {
+    unsigned int start = range_bound (a);
+    unsigned int end = start;
+    while (end < ranges.len && ranges[end].first <= b)
+      end++;
+    if (start == end)
+      return;
+    /* What is left of the first and last of those ranges. */
+    range_t r[2];
+    unsigned int count = 0;
+    if (ranges[start].first < a)
+    {
+      r[count].first = ranges[start].first;
+      r[count++].last = a - 1;
+    }
+    if (ranges[end - 1].last > b)
+    {
+      r[count].first = b + 1;
+      r[count++].last = ranges[end - 1].last;
+    }
+    ranges_replace (start, end, r, count);
+  }
+
+  /* Fills out with the ranges of the set, unless there are more than max. */
+  inline bool get_ranges (hb_vector_t<range_t, 1> &out, unsigned int max) const
+  {
+    out.resize (0);
+    if (in_ranges)
+    {
+      if (ranges.len > max || !out.resize (ranges.len))
+        return false;
+      memcpy (out.arrayZ(), ranges.arrayZ(), ranges.len * sizeof (ranges.arrayZ()[0]));
+      return true;
+    }
+    for (unsigned int i = 0; i < page_map.len; i++)
+    {
+      const page_t &page = page_at (i);
+      hb_codepoint_t base = major_start (page_map[i].major);
+      hb_codepoint_t g = page.get_min ();
+      if (g == INVALID)
+        continue;
+      for (;;)
+      {
+	range_t r = {base + g, base + page.run_end (g)};
+	if (out.len && out[out.len - 1].last + 1 == r.first)
+	  out[out.len - 1].last = r.last;
+	else if (out.len == max)
+	  return false;
+	else
+	  out.push (r);
+	g = r.last - base;
+	if (g == page_t::MASK || !page.next (&g))
+	  break;
+      }
+    }
+    return !out.in_error ();
+  }
+  inline void set_ranges (hb_vector_t<range_t, 1> &others)
+  {
+    ranges.fini ();
+    ranges = others;
+    others.init ();
+    page_map.fini ();
+    page_map.init ();
+    pages.fini ();
+    pages.init ();
+    in_ranges = true;
+  }
+  inline bool to_ranges (void)
+  {
+    hb_vector_t<range_t, 1> r;
+    r.init ();
+    if (!get_ranges (r, MAX_RANGES / 2))
+    {
+      r.fini ();
+      return false;
+    }
+    set_ranges (r);
+    return true;
+  }
+  inline void to_pages (void)
+  {
+    hb_vector_t<range_t, 1> r = ranges;
+    ranges.init ();
+    in_ranges = false;
+
+    /* The ranges are sorted, so the pages come out in order; size the
+     * vectors once and fill them front to back. */
+    unsigned int count = 0, major = INVALID;
+    for (unsigned int i = 0; i < r.len; i++)
+    {
+      unsigned int ma = get_major (r[i].first), mb = get_major (r[i].last);
+      count += mb - ma + (ma != major);
+      major = mb;
+    }
+    if (resize (count))
+    {
+      page_map_t *map = page_map.arrayZ();
+      page_t *page = nullptr;
+      count = 0;
+      major = INVALID;
+      for (unsigned int i = 0; i < r.len; i++)
+      {
+	hb_codepoint_t a = r[i].first, b = r[i].last;
+	for (unsigned int m = get_major (a); m <= get_major (b); m++)
+	{
+	  hb_codepoint_t start = major_start (m), end = start + page_t::MASK;
+	  if (m != major)
+	  {
+	    map[count].major = major = m;
+	    map[count].index = count;
+	    page = &pages.arrayZ()[count++];
+	    if (a <= start && end <= b)
+	    {
+	      page->init1 ();
+	      continue;
+	    }
+	    page->init0 ();
+	  }
+	  page->add_range (MAX (a, start), MIN (b, end));
+	}
+      }
+    }
+    r.fini ();
+  }
+
+  template <class Op>
+  inline bool process_ranges (const hb_set_t *other)
+  {
+    hb_vector_t<range_t, 1> a, b, out;
+    a.init ();
+    b.init ();
+    out.init ();
+    bool ret = get_ranges (a, MAX_RANGES) && other->get_ranges (b, MAX_RANGES);
+    if (ret)
+    {
+      /* Sweep over the boundaries of both; between two of them, either
+       * set has or lacks the whole stretch. */
+      unsigned int i = 0, j = 0;
+      uint64_t p = 0;
+      while (i < a.len || j < b.len)
+      {
+	bool in_a = i < a.len && a[i].first <= p;
+	bool in_b = j < b.len && b[j].first <= p;
+	uint64_t end = (uint64_t) -1;
+	if (i < a.len) end = MIN (end, in_a ? a[i].last + (uint64_t) 1 : (uint64_t) a[i].first);
+	if (j < b.len) end = MIN (end, in_b ? b[j].last + (uint64_t) 1 : (uint64_t) b[j].first);
+
+	unsigned int in;
+	Op::process (in, (unsigned int) in_a, (unsigned int) in_b);
+	if (in & 1)
+	{
+	  if (out.len && out[out.len - 1].last + (uint64_t) 1 == p)
+	    out[out.len - 1].last = end - 1;
+	  else
+	  {
+	    range_t r = {(hb_codepoint_t) p, (hb_codepoint_t) (end - 1)};
+	    out.push (r);
+	  }
+	}
+
+	p = end;
+	if (in_a && a[i].last < p) i++;
+	if (in_b && b[j].last < p) j++;
+      }
+      if (unlikely (out.in_error ()))
+        successful = false;
+      else
+      {
+	set_ranges (out);
+	if (ranges.len > MAX_RANGES)
+	  to_pages ();
+      }
+    }
+    a.fini ();
+    b.fini ();
+    out.fini ();
+    return ret;
+  }
 };
 
 
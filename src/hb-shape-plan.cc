@@ -31,6 +31,33 @@
 #include "hb-buffer.hh"
 
 
+/* Only the ot shaper looks at FeatureVariations; plans made by any other
+ * shaper do not depend on the coords. */
+static void
+hb_shape_plan_find_variations_indices (hb_face_t       *face,
+				       hb_shape_func_t *shaper_func,
+				       const int       *coords,
+				       unsigned int     num_coords,
+				       unsigned int     variations_index[2])
+{
+  variations_index[0] = variations_index[1] = HB_OT_LAYOUT_NO_VARIATIONS_INDEX;
+  if (shaper_func != _hb_ot_shape)
+    return;
+
+  if (!num_coords && !hb_object_is_inert (face))
+  {
+    face->shape_plans.get_default_variations_indices (face, variations_index);
+    return;
+  }
+
+  hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB,
+					      coords, num_coords,
+					      &variations_index[0]);
+  hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GPOS,
+					      coords, num_coords,
+					      &variations_index[1]);
+}
+
 static void
 hb_shape_plan_plan (hb_shape_plan_t    *shape_plan,
 		    const hb_feature_t *user_features,
@@ -107,6 +134,8 @@ DEFINE_NULL_INSTANCE (hb_shape_plan_t) =
   nullptr, /* coords */
   0,    /* num_coords */
 
+  {HB_OT_LAYOUT_NO_VARIATIONS_INDEX, HB_OT_LAYOUT_NO_VARIATIONS_INDEX}, /* variations_index */
+
   {
 #define HB_SHAPER_IMPLEMENT(shaper) HB_ATOMIC_PTR_INIT (HB_SHAPER_DATA_INVALID),
 #include "hb-shaper-list.hh"
@@ -194,12 +223,16 @@ hb_shape_plan_create2 (hb_face_t                     *face,
   shape_plan->coords = coords;
   if (num_coords)
     memcpy (coords, orig_coords, num_coords * sizeof (int));
-
   hb_shape_plan_plan (shape_plan,
 		      user_features, num_user_features,
 		      coords, num_coords,
 		      shaper_list);
 
+  hb_shape_plan_find_variations_indices (face,
+					 shape_plan->shaper_func,
+					 coords, num_coords,
+					 shape_plan->variations_index);
+
   return shape_plan;
 }
 
@@ -359,24 +392,135 @@ hb_shape_plan_execute (hb_shape_plan_t    *shape_plan,
   return false;
 }
 
+/* Shapes the runs of buffer that end at segment_ends, each as if it were
+ * alone in a buffer of its own, and replaces the contents of buffer with
+ * their glyphs, one run after the other.  Each entry of segment_ends is
+ * then set to where the glyphs of its run end.  The shaper data is only
+ * checked once for all the runs. */
+hb_bool_t
+hb_shape_plan_execute_segments (hb_shape_plan_t    *shape_plan,
+				hb_font_t          *font,
+				hb_buffer_t        *buffer,
+				unsigned int       *segment_ends,
+				unsigned int        num_segments,
+				const hb_feature_t *features,
+				unsigned int        num_features)
+{
+  DEBUG_MSG_FUNC (SHAPE_PLAN, shape_plan,
+		  "num_segments=%d num_features=%d shaper_func=%p, shaper_name=%s",
+		  num_segments,
+		  num_features,
+		  shape_plan->shaper_func,
+		  shape_plan->shaper_name);
+
+  unsigned int start = 0;
+  for (unsigned int i = 0; i < num_segments; i++)
+  {
+    if (unlikely (segment_ends[i] < start))
+      return false;
+    start = segment_ends[i];
+  }
+  if (unlikely (start != buffer->len))
+    return false;
+
+  if (unlikely (!buffer->len))
+    return true;
+
+  assert (!hb_object_is_inert (buffer));
+  assert (buffer->content_type == HB_BUFFER_CONTENT_TYPE_UNICODE);
+
+  if (unlikely (hb_object_is_inert (shape_plan)))
+    return false;
+
+  assert (shape_plan->face_unsafe == font->face);
+  assert (hb_segment_properties_equal (&shape_plan->props, &buffer->props));
+
+  bool ready = false;
+#define HB_SHAPER_ENSURE(shaper) \
+	HB_STMT_START { \
+	  ready = HB_SHAPER_DATA (shaper, shape_plan).get () && \
+		  hb_##shaper##_shaper_font_data_ensure (font); \
+	} HB_STMT_END
+
+  if (0)
+    ;
+#define HB_SHAPER_IMPLEMENT(shaper) \
+  else if (shape_plan->shaper_func == _hb_##shaper##_shape) \
+    HB_SHAPER_ENSURE (shaper);
+#include "hb-shaper-list.hh"
+#undef HB_SHAPER_IMPLEMENT
+
+#undef HB_SHAPER_ENSURE
+
+  if (unlikely (!ready))
+    return false;
+
+  /* The text is moved aside, and each run copied out of it into a buffer
+   * that is reused for all of them. */
+  hb_buffer_t *text = hb_buffer_create ();
+  hb_buffer_t *run = hb_buffer_create ();
+  if (unlikely (hb_object_is_inert (text) || hb_object_is_inert (run)))
+  {
+    hb_buffer_destroy (run);
+    hb_buffer_destroy (text);
+    return false;
+  }
+  hb_buffer_set_unicode_funcs (run, buffer->unicode);
+  hb_buffer_set_flags (run, buffer->flags);
+  hb_buffer_set_cluster_level (run, buffer->cluster_level);
+  hb_buffer_set_replacement_codepoint (run, buffer->replacement);
+  hb_buffer_set_invisible_glyph (run, buffer->invisible);
+
+  hb_buffer_append (text, buffer, 0, buffer->len);
+  bool ret = text->successful;
+  if (likely (ret))
+  {
+    buffer->len = 0;
+    buffer->clear_positions ();
+  }
+
+  start = 0;
+  for (unsigned int i = 0; ret && i < num_segments; i++)
+  {
+    unsigned int end = segment_ends[i];
+    if (start < end)
+    {
+      run->clear ();
+      run->props = buffer->props;
+      run->content_type = HB_BUFFER_CONTENT_TYPE_UNICODE;
+      ret = run->ensure (end - start);
+      if (unlikely (!ret))
+	break;
+      memcpy (run->info, text->info + start, (end - start) * sizeof (run->info[0]));
+      run->len = end - start;
+
+      ret = shape_plan->shaper_func (shape_plan, font, run, features, num_features) &&
+	    buffer->ensure (buffer->len + run->len);
+      if (unlikely (!ret))
+	break;
+      memcpy (buffer->info + buffer->len, run->info, run->len * sizeof (run->info[0]));
+      memcpy (buffer->pos + buffer->len, run->pos, run->len * sizeof (run->pos[0]));
+      buffer->len += run->len;
+    }
+    segment_ends[i] = buffer->len;
+    start = end;
+  }
+
+  hb_buffer_destroy (run);
+  hb_buffer_destroy (text);
+
+  return ret;
+}
+
 
 /*
  * caching
  */
 
-#if 0
-static unsigned int
-hb_shape_plan_hash (const hb_shape_plan_t *shape_plan)
-{
-  return hb_segment_properties_hash (&shape_plan->props) +
-	 shape_plan->default_shaper_list ? 0 : (intptr_t) shape_plan->shaper_func;
-}
-#endif
-
-/* User-feature caching is currently somewhat dumb:
- * it only finds matches where the feature array is identical,
- * not cases where the feature lists would be compatible for plan purposes
- * but have different ranges, for example.
+/* A plan only depends on the tag, value and global-ness of each user
+ * feature; the ranges of non-global features are applied to the buffer
+ * masks at execute time.  So features are matched on just those, and
+ * plans compiled for different ranges are shared.
  */
 struct hb_shape_plan_proposal_t
 {
@@ -384,11 +528,42 @@ struct hb_shape_plan_proposal_t
   const char * const            *shaper_list;
   const hb_feature_t            *user_features;
   unsigned int                   num_user_features;
-  const int                     *coords;
-  unsigned int                   num_coords;
+  unsigned int                   variations_index[2];
   hb_shape_func_t               *shaper_func;
 };
 
+static inline bool
+hb_shape_plan_user_feature_is_global (const hb_feature_t *feature)
+{
+  return feature->start == HB_FEATURE_GLOBAL_START &&
+	 feature->end == HB_FEATURE_GLOBAL_END;
+}
+
+static inline unsigned int
+hb_shape_plan_user_features_hash (const hb_feature_t *user_features,
+				  unsigned int        num_user_features)
+{
+  unsigned int h = num_user_features;
+  for (unsigned int i = 0; i < num_user_features; i++)
+  {
+    h = h * 31 + user_features[i].tag;
+    h = h * 31 + user_features[i].value;
+    h = h * 31 + hb_shape_plan_user_feature_is_global (&user_features[i]);
+  }
+  return h;
+}
+
+static inline unsigned int
+hb_shape_plan_proposal_hash (const hb_shape_plan_proposal_t *proposal)
+{
+  unsigned int h = hb_segment_properties_hash (&proposal->props);
+  h = h * 31 + hb_shape_plan_user_features_hash (proposal->user_features,
+						 proposal->num_user_features);
+  h = h * 31 + proposal->variations_index[0];
+  h = h * 31 + proposal->variations_index[1];
+  return h;
+}
+
 static inline hb_bool_t
 hb_shape_plan_user_features_match (const hb_shape_plan_t          *shape_plan,
 				   const hb_shape_plan_proposal_t *proposal)
@@ -398,22 +573,18 @@ hb_shape_plan_user_features_match (const hb_shape_plan_t          *shape_plan,
   for (unsigned int i = 0, n = proposal->num_user_features; i < n; i++)
     if (proposal->user_features[i].tag   != shape_plan->user_features[i].tag   ||
         proposal->user_features[i].value != shape_plan->user_features[i].value ||
-        proposal->user_features[i].start != shape_plan->user_features[i].start ||
-        proposal->user_features[i].end   != shape_plan->user_features[i].end)
+        hb_shape_plan_user_feature_is_global (&proposal->user_features[i]) !=
+        hb_shape_plan_user_feature_is_global (&shape_plan->user_features[i]))
       return false;
   return true;
 }
 
 static inline hb_bool_t
-hb_shape_plan_coords_match (const hb_shape_plan_t          *shape_plan,
-			    const hb_shape_plan_proposal_t *proposal)
+hb_shape_plan_variations_match (const hb_shape_plan_t          *shape_plan,
+				const hb_shape_plan_proposal_t *proposal)
 {
-  if (proposal->num_coords != shape_plan->num_coords)
-    return false;
-  for (unsigned int i = 0, n = proposal->num_coords; i < n; i++)
-    if (proposal->coords[i] != shape_plan->coords[i])
-      return false;
-  return true;
+  return proposal->variations_index[0] == shape_plan->variations_index[0] &&
+	 proposal->variations_index[1] == shape_plan->variations_index[1];
 }
 
 static hb_bool_t
@@ -422,29 +593,261 @@ hb_shape_plan_matches (const hb_shape_plan_t          *shape_plan,
 {
   return hb_segment_properties_equal (&shape_plan->props, &proposal->props) &&
 	 hb_shape_plan_user_features_match (shape_plan, proposal) &&
-	 hb_shape_plan_coords_match (shape_plan, proposal) &&
+	 hb_shape_plan_variations_match (shape_plan, proposal) &&
 	 ((shape_plan->default_shaper_list && !proposal->shaper_list) ||
 	  (shape_plan->shaper_func == proposal->shaper_func));
 }
 
-static inline hb_bool_t
-hb_non_global_user_features_present (const hb_feature_t *user_features,
-				     unsigned int        num_user_features)
-{
-  while (num_user_features) {
-    if (user_features->start != 0 || user_features->end != (unsigned int) -1)
-      return true;
-    num_user_features--;
-    user_features++;
+
+/*
+ * hb_shape_plan_cache_t
+ */
+
+hb_shape_plan_t *
+hb_shape_plan_cache_t::lookup (unsigned int hash,
+			       const hb_shape_plan_proposal_t *proposal) const
+{
+  for (item_t *item = buckets[hash % NUM_BUCKETS].get ();
+       item;
+       item = item->next.get ())
+    if (item->hash == hash &&
+	hb_shape_plan_matches (item->shape_plan, proposal))
+    {
+      if (!item->referenced.get_relaxed ())
+	item->referenced.set_relaxed (true);
+      return hb_shape_plan_reference (item->shape_plan);
+    }
+  return nullptr;
+}
+
+/* Removes item from its bucket chain.  Lookups that started earlier may
+ * still be looking at it until synchronize() returns.  Must be called with
+ * the lock held. */
+inline void
+hb_shape_plan_cache_t::unlink (item_t *item)
+{
+  hb_atomic_ptr_t<item_t *> *p = &buckets[item->hash % NUM_BUCKETS];
+  while (p->get_relaxed () != item)
+    p = &p->get_relaxed ()->next;
+  /* Only ever changed under the lock, so this always succeeds. */
+  (void) p->cmpexch (item, item->next.get_relaxed ());
+}
+
+/* Waits for the lookups that might have seen an item unlinked before this
+ * was called to finish.  Must be called with the lock held. */
+inline void
+hb_shape_plan_cache_t::synchronize (void)
+{
+  /* Lookups that count themselves in the old epoch's slot from now on see
+   * the new epoch and back off; the ones that counted themselves before
+   * are waited for.  The barriers order the epoch against the counts on
+   * both sides. */
+  int old_epoch = epoch.inc ();
+  _hb_memory_barrier ();
+  while (readers[old_epoch & 1].get ())
+    ;
+}
+
+void
+hb_shape_plan_cache_t::fini (void)
+{
+  /* No lookups can be in progress anymore. */
+  for (unsigned int i = 0; i < len; i++)
+  {
+    hb_shape_plan_destroy (items[i]->shape_plan);
+    free (items[i]);
   }
-  return false;
+  free (items);
+  lock.fini ();
 }
 
-static inline hb_bool_t
-hb_coords_present (const int *coords,
-		   unsigned int num_coords)
+hb_shape_plan_t *
+hb_shape_plan_cache_t::find (unsigned int hash,
+			     const hb_shape_plan_proposal_t *proposal)
 {
-  return num_coords != 0;
+  unsigned int slot;
+  for (;;)
+  {
+    int e = epoch.get ();
+    slot = e & 1;
+    readers[slot].inc ();
+    _hb_memory_barrier ();
+    if (likely (epoch.get () == e))
+      break;
+    readers[slot].dec (); /* Raced with synchronize(); retry in the new epoch. */
+  }
+  hb_shape_plan_t *shape_plan = lookup (hash, proposal);
+  readers[slot].dec ();
+
+  if (shape_plan)
+    hits.inc ();
+  else
+    misses.inc ();
+
+  return shape_plan;
+}
+
+hb_shape_plan_t *
+hb_shape_plan_cache_t::insert (unsigned int hash,
+			       const hb_shape_plan_proposal_t *proposal,
+			       hb_shape_plan_t *shape_plan)
+{
+  hb_shape_plan_t *ret;
+
+  lock.lock ();
+  ret = lookup (hash, proposal);
+  if (ret)
+  {
+    lock.unlock ();
+    hb_shape_plan_destroy (shape_plan); /* Another thread beat us to it. */
+    return ret;
+  }
+
+  if (!max_plans)
+  {
+    lock.unlock ();
+    return shape_plan;
+  }
+
+  item_t *item = (item_t *) calloc (1, sizeof (item_t));
+  if (unlikely (!item))
+  {
+    lock.unlock ();
+    return shape_plan;
+  }
+  item->shape_plan = shape_plan;
+  item->hash = hash;
+
+  item_t *evicted = nullptr;
+  if (len >= max_plans)
+  {
+    /* Advance the clock hand to a plan that was not hit since the hand
+     * last passed it, and replace that one. */
+    while (items[hand]->referenced.get_relaxed ())
+    {
+      items[hand]->referenced.set_relaxed (false);
+      hand = (hand + 1) % len;
+    }
+    evicted = items[hand];
+    items[hand] = item;
+    hand = (hand + 1) % len;
+
+    unlink (evicted);
+    evictions.inc ();
+  }
+  else
+  {
+    if (unlikely (len >= allocated))
+    {
+      unsigned int new_allocated = MIN (MAX (allocated * 2, 8u), max_plans);
+      item_t **new_items = nullptr;
+      if (likely (!hb_unsigned_mul_overflows (new_allocated, sizeof (items[0]))))
+	new_items = (item_t **) realloc (items, new_allocated * sizeof (items[0]));
+      if (unlikely (!new_items))
+      {
+	lock.unlock ();
+	free (item);
+	return shape_plan;
+      }
+      items = new_items;
+      allocated = new_allocated;
+    }
+    items[len++] = item;
+  }
+
+  /* Publish the item in full before lookups can reach it. */
+  hb_atomic_ptr_t<item_t *> &head = buckets[hash % NUM_BUCKETS];
+  item->next.set_relaxed (head.get_relaxed ());
+  (void) head.cmpexch (item->next.get_relaxed (), item);
+
+  /* The cache keeps the caller's reference; hand out a new one. */
+  ret = hb_shape_plan_reference (shape_plan);
+  DEBUG_MSG_FUNC (SHAPE_PLAN, shape_plan, "inserted into cache");
+
+  if (evicted)
+  {
+    synchronize ();
+    hb_shape_plan_destroy (evicted->shape_plan);
+    free (evicted);
+  }
+  lock.unlock ();
+
+  return ret;
+}
+
+void
+hb_shape_plan_cache_t::set_max_plans (unsigned int max_plans_)
+{
+  lock.lock ();
+  max_plans = max_plans_;
+  if (len > max_plans)
+  {
+    /* Shrinking below the current population drops all cached plans. */
+    for (unsigned int b = 0; b < NUM_BUCKETS; b++)
+      (void) buckets[b].cmpexch (buckets[b].get_relaxed (), nullptr);
+    synchronize ();
+    for (unsigned int i = 0; i < len; i++)
+    {
+      hb_shape_plan_destroy (items[i]->shape_plan);
+      free (items[i]);
+    }
+    len = 0;
+    hand = 0;
+  }
+  lock.unlock ();
+}
+
+void
+hb_shape_plan_cache_t::get_default_variations_indices (hb_face_t *face,
+						      unsigned int variations_index_[2])
+{
+  /* Racing threads compute the same values, so storing them separately
+   * is fine. */
+  int gsub = default_variations_index[0].get_relaxed ();
+  int gpos = default_variations_index[1].get_relaxed ();
+  if (unlikely (gsub == UNKNOWN_VARIATIONS_INDEX || gpos == UNKNOWN_VARIATIONS_INDEX))
+  {
+    unsigned int index;
+    hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB, nullptr, 0, &index);
+    gsub = index;
+    hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GPOS, nullptr, 0, &index);
+    gpos = index;
+    default_variations_index[0].set_relaxed (gsub);
+    default_variations_index[1].set_relaxed (gpos);
+  }
+  variations_index_[0] = gsub;
+  variations_index_[1] = gpos;
+}
+
+void
+hb_shape_plan_cache_t::get_stats (unsigned int *hits_,
+				  unsigned int *misses_,
+				  unsigned int *evictions_)
+{
+  if (hits_) *hits_ = hits.get_relaxed ();
+  if (misses_) *misses_ = misses.get_relaxed ();
+  if (evictions_) *evictions_ = evictions.get_relaxed ();
+}
+
+
+/* The shaper hb_shape_plan_plan() picks for face from the default
+ * shaper list. */
+static hb_shape_func_t *
+hb_shape_plan_choose_default_shaper (hb_face_t *face)
+{
+  const hb_shaper_pair_t *shapers = _hb_shapers_get ();
+
+  for (unsigned int i = 0; i < HB_SHAPERS_COUNT; i++)
+    if (0)
+      ;
+#define HB_SHAPER_IMPLEMENT(shaper) \
+    else if (shapers[i].func == _hb_##shaper##_shape && \
+	     hb_##shaper##_shaper_face_data_ensure (face)) \
+      return _hb_##shaper##_shape;
+#include "hb-shaper-list.hh"
+#undef HB_SHAPER_IMPLEMENT
+
+  return nullptr;
 }
 
 /**
@@ -494,6 +897,7 @@ hb_shape_plan_create_cached2 (hb_face_t                     *face,
     shaper_list,
     user_features,
     num_user_features,
+    {HB_OT_LAYOUT_NO_VARIATIONS_INDEX, HB_OT_LAYOUT_NO_VARIATIONS_INDEX},
     nullptr
   };
 
@@ -518,51 +922,36 @@ hb_shape_plan_create_cached2 (hb_face_t                     *face,
   }
 
 
-retry:
-  hb_face_t::plan_node_t *cached_plan_nodes = face->shape_plans.get ();
-
-  /* Don't look for plan in the cache if there were variation coordinates XXX Fix me. */
-  if (!hb_coords_present (coords, num_coords))
-    for (hb_face_t::plan_node_t *node = cached_plan_nodes; node; node = node->next)
-      if (hb_shape_plan_matches (node->shape_plan, &proposal))
-      {
-        DEBUG_MSG_FUNC (SHAPE_PLAN, node->shape_plan, "fulfilled from cache");
-        return hb_shape_plan_reference (node->shape_plan);
-      }
-
-  /* Not found. */
-  hb_shape_plan_t *shape_plan = hb_shape_plan_create2 (face, props,
-						       user_features, num_user_features,
-						       coords, num_coords,
-						       shaper_list);
-
-  /* Don't add to the cache if face is inert. */
+  /* Don't use the cache if face is inert. */
   if (unlikely (hb_object_is_inert (face)))
-    return shape_plan;
-
-  /* Don't add the plan to the cache if there were user features with non-global ranges */
-  if (hb_non_global_user_features_present (user_features, num_user_features))
-    return shape_plan;
-  /* Don't add the plan to the cache if there were variation coordinates XXX Fix me. */
-  if (hb_coords_present (coords, num_coords))
-    return shape_plan;
-
-  hb_face_t::plan_node_t *node = (hb_face_t::plan_node_t *) calloc (1, sizeof (hb_face_t::plan_node_t));
-  if (unlikely (!node))
-    return shape_plan;
-
-  node->shape_plan = shape_plan;
-  node->next = cached_plan_nodes;
-
-  if (unlikely (!face->shape_plans.cmpexch (cached_plan_nodes, node)))
+    return hb_shape_plan_create2 (face, props,
+				  user_features, num_user_features,
+				  coords, num_coords,
+				  shaper_list);
+
+  /* Instances that select the same FeatureVariations records share a plan. */
+  hb_shape_plan_find_variations_indices (face,
+					 proposal.shaper_func ? proposal.shaper_func :
+					 hb_shape_plan_choose_default_shaper (face),
+					 coords, num_coords,
+					 proposal.variations_index);
+
+  unsigned int hash = hb_shape_plan_proposal_hash (&proposal);
+
+  hb_shape_plan_t *shape_plan = face->shape_plans.find (hash, &proposal);
+  if (shape_plan)
   {
-    hb_shape_plan_destroy (shape_plan);
-    free (node);
-    goto retry;
+    DEBUG_MSG_FUNC (SHAPE_PLAN, shape_plan, "fulfilled from cache");
+    return shape_plan;
   }
-  DEBUG_MSG_FUNC (SHAPE_PLAN, shape_plan, "inserted into cache");
 
-  return hb_shape_plan_reference (shape_plan);
+  /* Not found. */
+  shape_plan = hb_shape_plan_create2 (face, props,
+				      user_features, num_user_features,
+				      coords, num_coords,
+				      shaper_list);
+
+  return face->shape_plans.insert (hash, &proposal, shape_plan);
 }
 
 /**
@@ -580,3 +969,73 @@ hb_shape_plan_get_shaper (hb_shape_plan_t *shape_plan)
 {
   return shape_plan->shaper_name;
 }
+
+
+/**
+ * hb_shape_plan_cache_set_size:
+ * @face: a face.
+ * @max_plans: maximum number of shape plans to cache for @face.
+ *
+ * Bounds the number of shape plans hb_shape_plan_create_cached() keeps
+ * around for @face.  Once that many are cached, the plan that has gone
+ * unused the longest (approximately) is evicted to make room for a new one.
+ * Zero disables caching.  Shrinking the cache below the number of plans
+ * currently in it drops all of them.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_shape_plan_cache_set_size (hb_face_t    *face,
+			      unsigned int  max_plans)
+{
+  if (unlikely (hb_object_is_inert (face)))
+    return;
+
+  face->shape_plans.set_max_plans (max_plans);
+}
+
+/**
+ * hb_shape_plan_cache_get_size:
+ * @face: a face.
+ *
+ * Return value: the maximum number of shape plans cached for @face.
+ *
+ * Since: REPLACEME
+ **/
+unsigned int
+hb_shape_plan_cache_get_size (hb_face_t *face)
+{
+  return face->shape_plans.max_plans;
+}
+
+/**
+ * hb_shape_plan_cache_get_stats:
+ * @face: a face.
+ * @hits: (out) (optional): number of lookups satisfied from the cache.
+ * @misses: (out) (optional): number of lookups that had to create a plan.
+ * @evictions: (out) (optional): number of plans evicted to make room.
+ *
+ * Fetches counters of the shape-plan cache of @face.  Every plan requested
+ * through hb_shape_plan_create_cached() or hb_shape_plan_create_cached2()
+ * on a face that is not inert counts as a hit or a miss, whatever its user
+ * features and variation coordinates.  Counts taken while other threads
+ * are shaping on @face may be slightly out of date.
+ *
+ * Since: REPLACEME
+ **/
+void
+hb_shape_plan_cache_get_stats (hb_face_t    *face,
+			       unsigned int *hits,      /* OUT.  May be NULL */
+			       unsigned int *misses,    /* OUT.  May be NULL */
+			       unsigned int *evictions  /* OUT.  May be NULL */)
+{
+  if (unlikely (hb_object_is_inert (face)))
+  {
+    if (hits) *hits = 0;
+    if (misses) *misses = 0;
+    if (evictions) *evictions = 0;
+    return;
+  }
+
+  face->shape_plans.get_stats (hits, misses, evictions);
+}
@@ -103,6 +103,20 @@ HB_EXTERN const char *
 hb_shape_plan_get_shaper (hb_shape_plan_t *shape_plan);
 
 
+HB_EXTERN void
+hb_shape_plan_cache_set_size (hb_face_t    *face,
+			      unsigned int  max_plans);
+
+HB_EXTERN unsigned int
+hb_shape_plan_cache_get_size (hb_face_t *face);
+
+HB_EXTERN void
+hb_shape_plan_cache_get_stats (hb_face_t    *face,
+			       unsigned int *hits,      /* OUT.  May be NULL */
+			       unsigned int *misses,    /* OUT.  May be NULL */
+			       unsigned int *evictions  /* OUT.  May be NULL */);
+
+
 HB_END_DECLS
 
 #endif /* HB_SHAPE_PLAN_H */
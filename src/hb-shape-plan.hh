@@ -49,10 +49,23 @@ struct hb_shape_plan_t
   int *coords;
   unsigned int num_coords;
 
+  /* The FeatureVariations records the coords select in GSUB and GPOS.
+   * This, not the coords themselves, is what the plan depends on. */
+  unsigned int variations_index[2];
+
   struct hb_shaper_data_t shaper_data;
 };
 DECLARE_NULL_INSTANCE (hb_shape_plan_t);
 
+HB_INTERNAL hb_bool_t
+hb_shape_plan_execute_segments (hb_shape_plan_t    *shape_plan,
+				hb_font_t          *font,
+				hb_buffer_t        *buffer,
+				unsigned int       *segment_ends,
+				unsigned int        num_segments,
+				const hb_feature_t *features,
+				unsigned int        num_features);
+
 #define HB_SHAPER_DATA_CREATE_FUNC_EXTRA_ARGS \
 	, const hb_feature_t *user_features \
 	, unsigned int        num_user_features \
@@ -64,4 +77,106 @@ DECLARE_NULL_INSTANCE (hb_shape_plan_t);
 #undef HB_SHAPER_DATA_CREATE_FUNC_EXTRA_ARGS
 
 
+/*
+ * hb_shape_plan_cache_t
+ *
+ * Per-face cache of shape plans.  Plans are chained into buckets by a hash
+ * of their segment properties and user features, so a lookup only compares
+ * against plans that are likely to match.  The cache is bounded: once it
+ * holds max_plans plans, inserting another one evicts a plan that has not
+ * been hit recently, using the CLOCK approximation of LRU.
+ *
+ * Lookups take no lock; they only follow the bucket chains, which are
+ * changed under the lock one pointer at a time.  Each lookup counts itself
+ * in one of two reader counts, picked by the parity of the epoch.  Before
+ * an unlinked plan is released, the epoch is advanced and the count of the
+ * previous epoch is waited on to drain, after which no lookup can still be
+ * looking at it.  Evicted plans are thus released right away and the cache
+ * never holds more than max_plans plans.  The lock is never held while a
+ * plan is being created.
+ */
+
+#ifndef HB_SHAPE_PLAN_CACHE_DEFAULT_MAX_PLANS
+#define HB_SHAPE_PLAN_CACHE_DEFAULT_MAX_PLANS 256
+#endif
+
+struct hb_shape_plan_proposal_t;
+
+struct hb_shape_plan_cache_t
+{
+  struct item_t
+  {
+    hb_shape_plan_t *shape_plan;
+    unsigned int hash;
+    hb_atomic_ptr_t<item_t *> next; /* Next item in the same bucket. */
+    hb_atomic_int_t referenced; /* Set on every hit; cleared as the clock hand passes. */
+  };
+
+  enum { NUM_BUCKETS = 64 };
+
+  hb_mutex_t lock;
+  hb_atomic_ptr_t<item_t *> buckets[NUM_BUCKETS];
+  hb_atomic_int_t epoch;
+  hb_atomic_int_t readers[2]; /* Lookups in progress, by epoch parity. */
+
+  /* Only accessed under the lock. */
+  item_t **items; /* All cached items, in clock order. */
+  unsigned int len;
+  unsigned int allocated;
+  unsigned int max_plans;
+  unsigned int hand; /* Clock hand; index into items. */
+
+  /* FeatureVariations indices of GSUB and GPOS selected without coords. */
+  enum { UNKNOWN_VARIATIONS_INDEX = -2 };
+  hb_atomic_int_t default_variations_index[2];
+
+  /* Statistics. */
+  hb_atomic_int_t hits;
+  hb_atomic_int_t misses;
+  hb_atomic_int_t evictions;
+
+  inline void init (void)
+  {
+    lock.init ();
+    for (unsigned int i = 0; i < NUM_BUCKETS; i++)
+      buckets[i].init ();
+    epoch.set_relaxed (0);
+    readers[0].set_relaxed (0);
+    readers[1].set_relaxed (0);
+    items = nullptr;
+    len = allocated = 0;
+    max_plans = HB_SHAPE_PLAN_CACHE_DEFAULT_MAX_PLANS;
+    hand = 0;
+    default_variations_index[0].set_relaxed (UNKNOWN_VARIATIONS_INDEX);
+    default_variations_index[1].set_relaxed (UNKNOWN_VARIATIONS_INDEX);
+    hits.set_relaxed (0);
+    misses.set_relaxed (0);
+    evictions.set_relaxed (0);
+  }
+  HB_INTERNAL void fini (void);
+
+  /* Returns a new reference to a cached plan matching proposal, or nullptr. */
+  HB_INTERNAL hb_shape_plan_t *find (unsigned int hash,
+				     const hb_shape_plan_proposal_t *proposal);
+  /* Caches shape_plan, unless an equivalent plan got cached in the
+   * meantime.  Either way, consumes the caller's reference to shape_plan
+   * and returns a new reference to the plan that is in the cache. */
+  HB_INTERNAL hb_shape_plan_t *insert (unsigned int hash,
+				       const hb_shape_plan_proposal_t *proposal,
+				       hb_shape_plan_t *shape_plan);
+  HB_INTERNAL void set_max_plans (unsigned int max_plans);
+  HB_INTERNAL void get_default_variations_indices (hb_face_t *face,
+						   unsigned int variations_index[2]);
+  HB_INTERNAL void get_stats (unsigned int *hits,
+			      unsigned int *misses,
+			      unsigned int *evictions);
+
+  private:
+  inline hb_shape_plan_t *lookup (unsigned int hash,
+				  const hb_shape_plan_proposal_t *proposal) const;
+  inline void unlink (item_t *item);
+  inline void synchronize (void);
+};
+
+
 #endif /* HB_SHAPE_PLAN_HH */
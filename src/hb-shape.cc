@@ -146,6 +146,62 @@ hb_shape_full (hb_font_t          *font,
   return res;
 }
 
+/**
+ * hb_shape_batch:
+ * @font: an #hb_font_t to use for shaping
+ * @buffer: an #hb_buffer_t holding the runs to shape, one after the other
+ * @segment_ends: (array length=num_segments) (inout): where each run ends
+ *    in @buffer; on return, where its glyphs end
+ * @num_segments: the length of @segment_ends array
+ * @features: (array length=num_features) (allow-none): an array of user
+ *    specified #hb_feature_t or %NULL
+ * @num_features: the length of @features array
+ * @shaper_list: (array zero-terminated=1) (allow-none): a %NULL-terminated
+ *    array of shapers to use or %NULL
+ *
+ * Shapes many short runs of text that share @font, @features and the
+ * segment properties of @buffer, like words or labels, in one call.  The
+ * runs are added to @buffer back to back, and @segment_ends gives the
+ * offset in @buffer where each of them ends; the last one must end at the
+ * length of @buffer.
+ *
+ * Each run is shaped as if it were alone in a buffer of its own, with no
+ * context, and keeps the cluster values it had in @buffer.  On return,
+ * @buffer holds the glyphs of all the runs, in order, and each entry of
+ * @segment_ends is set to where the glyphs of its run end.
+ *
+ * This does what calling hb_shape_full() on each run would, but looks up
+ * the shape plan, prepares the font and checks the buffer only once.  The
+ * message and profile callbacks of @buffer are not called.
+ *
+ * Return value: false if @segment_ends does not cover @buffer or all
+ * shapers failed, true otherwise
+ *
+ * Since: REPLACEME
+ **/
+hb_bool_t
+hb_shape_batch (hb_font_t          *font,
+		hb_buffer_t        *buffer,
+		unsigned int       *segment_ends,
+		unsigned int        num_segments,
+		const hb_feature_t *features,
+		unsigned int        num_features,
+		const char * const *shaper_list)
+{
+  hb_shape_plan_t *shape_plan = hb_shape_plan_create_cached2 (font->face, &buffer->props,
+							      features, num_features,
+							      font->coords, font->num_coords,
+							      shaper_list);
+  hb_bool_t res = hb_shape_plan_execute_segments (shape_plan, font, buffer,
+						  segment_ends, num_segments,
+						  features, num_features);
+  hb_shape_plan_destroy (shape_plan);
+
+  if (res)
+    buffer->content_type = HB_BUFFER_CONTENT_TYPE_GLYPHS;
+  return res;
+}
+
 /**
  * hb_shape:
  * @font: an #hb_font_t to use for shaping
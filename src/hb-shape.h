@@ -53,6 +53,15 @@ hb_shape_full (hb_font_t          *font,
 	       unsigned int        num_features,
 	       const char * const *shaper_list);
 
+HB_EXTERN hb_bool_t
+hb_shape_batch (hb_font_t          *font,
+		hb_buffer_t        *buffer,
+		unsigned int       *segment_ends, /* IN/OUT */
+		unsigned int        num_segments,
+		const hb_feature_t *features,
+		unsigned int        num_features,
+		const char * const *shaper_list);
+
 HB_EXTERN const char **
 hb_shape_list_shapers (void);
 
@@ -84,6 +84,7 @@ _populate_gids_to_retain (hb_face_t *face,
   hb_set_t *initial_gids_to_retain = hb_set_create ();
   initial_gids_to_retain->add (0); // Not-def
 
+  hb_auto_t<hb_vector_t<hb_codepoint_t> > gids;
   hb_codepoint_t cp = HB_SET_VALUE_INVALID;
   while (unicodes->next (&cp))
   {
@@ -94,10 +95,18 @@ _populate_gids_to_retain (hb_face_t *face,
       continue;
     }
     unicodes_to_retain->add (cp);
-    codepoint_to_glyph->set (cp, gid);
+    gids.push (gid);
     initial_gids_to_retain->add (gid);
   }
 
+  /* Sized for the codepoints the font maps, which can be far fewer than
+   * the ones asked for. */
+  codepoint_to_glyph->alloc (unicodes_to_retain->get_population (),
+			     unicodes_to_retain->get_max ());
+  cp = HB_SET_VALUE_INVALID;
+  for (unsigned int i = 0; unicodes_to_retain->next (&cp); i++)
+    codepoint_to_glyph->set (cp, gids[i]);
+
   if (close_over_gsub)
     // Add all glyphs needed for GSUB substitutions.
     _gsub_closure (face, initial_gids_to_retain);
@@ -127,6 +136,9 @@ static void
 _create_old_gid_to_new_gid_map (const hb_vector_t<hb_codepoint_t> &glyphs,
                                 hb_map_t *glyph_map)
 {
+  /* The glyphs are sorted, so the last one is the largest. */
+  if (glyphs.len)
+    glyph_map->alloc (glyphs.len, glyphs[glyphs.len - 1]);
   for (unsigned int i = 0; i < glyphs.len; i++) {
     glyph_map->set (glyphs[i], i);
   }
@@ -132,9 +132,9 @@ _subset (hb_subset_plan_t *plan)
 }
 
 
-static bool
-_subset_table (hb_subset_plan_t *plan,
-               hb_tag_t          tag)
+bool
+hb_subset_table (hb_subset_plan_t *plan,
+		 hb_tag_t          tag)
 {
   DEBUG_MSG(SUBSET, nullptr, "begin subset %c%c%c%c", HB_UNTAG(tag));
   bool result = true;
@@ -198,8 +198,8 @@ _subset_table (hb_subset_plan_t *plan,
   return result;
 }
 
-static bool
-_should_drop_table(hb_subset_plan_t *plan, hb_tag_t tag)
+bool
+hb_subset_should_drop_table (hb_subset_plan_t *plan, hb_tag_t tag)
 {
   switch (tag) {
     case HB_TAG ('c', 'v', 'a', 'r'): /* hint table, fallthrough */
@@ -263,12 +263,12 @@ hb_subset (hb_face_t *source,
     for (unsigned int i = 0; i < count; i++)
     {
       hb_tag_t tag = table_tags[i];
-      if (_should_drop_table(plan, tag))
+      if (hb_subset_should_drop_table (plan, tag))
       {
         DEBUG_MSG(SUBSET, nullptr, "drop %c%c%c%c", HB_UNTAG(tag));
         continue;
       }
-      success = success && _subset_table (plan, tag);
+      success = success && hb_subset_table (plan, tag);
     }
     offset += count;
   } while (success && count == ARRAY_LENGTH (table_tags));
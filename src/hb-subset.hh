@@ -57,4 +57,13 @@ struct hb_subset_context_t :
 };
 
 
+/* The steps of hb_subset(), exposed for perf/perf-subset. */
+
+HB_INTERNAL bool
+hb_subset_should_drop_table (hb_subset_plan_t *plan, hb_tag_t tag);
+
+HB_INTERNAL bool
+hb_subset_table (hb_subset_plan_t *plan, hb_tag_t tag);
+
+
 #endif /* HB_SUBSET_HH */
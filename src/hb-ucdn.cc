@@ -17,6 +17,7 @@
 #include "hb.hh"
 
 #include "hb-machinery.hh"
+#include "hb-unicode.hh"
 
 #include "ucdn.h"
 
@@ -189,6 +190,30 @@ hb_ucdn_general_category(hb_unicode_funcs_t *ufuncs HB_UNUSED,
     return (hb_unicode_general_category_t)ucdn_get_general_category(unicode);
 }
 
+static void
+hb_ucdn_general_categories(hb_unicode_funcs_t *ufuncs,
+			   unsigned int count,
+			   const hb_codepoint_t *first_unicode,
+			   unsigned int unicode_stride,
+			   hb_unicode_general_category_t *first_category,
+			   unsigned int category_stride,
+			   void *user_data HB_UNUSED)
+{
+    if (unlikely (ufuncs->func.general_category != hb_ucdn_general_category)) {
+	ufuncs->general_categories_one_by_one (count,
+					       first_unicode, unicode_stride,
+					       first_category, category_stride);
+	return;
+    }
+
+    /* The packed table carries the UCDN general categories. */
+    for (unsigned int i = 0; i < count; i++) {
+	*first_category = (hb_unicode_general_category_t) (_hb_unicode_props (*first_unicode) & HB_UNICODE_PROPS_GEN_CAT);
+	first_unicode = &StructAtOffset<const hb_codepoint_t> (first_unicode, unicode_stride);
+	first_category = &StructAtOffset<hb_unicode_general_category_t> (first_category, category_stride);
+    }
+}
+
 static hb_codepoint_t
 hb_ucdn_mirroring(hb_unicode_funcs_t *ufuncs HB_UNUSED,
 		  hb_codepoint_t unicode,
@@ -205,6 +230,29 @@ hb_ucdn_script(hb_unicode_funcs_t *ufuncs HB_UNUSED,
     return ucdn_script_translate[ucdn_get_script(unicode)];
 }
 
+static void
+hb_ucdn_scripts(hb_unicode_funcs_t *ufuncs,
+		unsigned int count,
+		const hb_codepoint_t *first_unicode,
+		unsigned int unicode_stride,
+		hb_script_t *first_script,
+		unsigned int script_stride,
+		void *user_data HB_UNUSED)
+{
+    if (unlikely (ufuncs->func.script != hb_ucdn_script)) {
+	ufuncs->scripts_one_by_one (count,
+				    first_unicode, unicode_stride,
+				    first_script, script_stride);
+	return;
+    }
+
+    for (unsigned int i = 0; i < count; i++) {
+	*first_script = ucdn_script_translate[ucdn_get_script(*first_unicode)];
+	first_unicode = &StructAtOffset<const hb_codepoint_t> (first_unicode, unicode_stride);
+	first_script = &StructAtOffset<hb_script_t> (first_script, script_stride);
+    }
+}
+
 static hb_bool_t
 hb_ucdn_compose(hb_unicode_funcs_t *ufuncs HB_UNUSED,
 		hb_codepoint_t a, hb_codepoint_t b, hb_codepoint_t *ab,
@@ -238,6 +286,16 @@ static struct hb_ucdn_unicode_funcs_lazy_loader_t : hb_unicode_funcs_lazy_loader
     hb_unicode_funcs_set_script_func (funcs, hb_ucdn_script, nullptr, nullptr);
     hb_unicode_funcs_set_compose_func (funcs, hb_ucdn_compose, nullptr, nullptr);
     hb_unicode_funcs_set_decompose_func (funcs, hb_ucdn_decompose, nullptr, nullptr);
+    hb_unicode_funcs_set_general_categories_func (funcs, hb_ucdn_general_categories, nullptr, nullptr);
+    hb_unicode_funcs_set_scripts_func (funcs, hb_ucdn_scripts, nullptr, nullptr);
+
+    if (likely (!hb_object_is_inert (funcs)))
+    {
+      funcs->canonical.compose = hb_ucdn_compose;
+      funcs->canonical.decompose = hb_ucdn_decompose;
+      funcs->tabled.general_category = hb_ucdn_general_category;
+      funcs->tabled.combining_class = hb_ucdn_combining_class;
+    }
 
     hb_unicode_funcs_make_immutable (funcs);
 
@@ -0,0 +1,326 @@
+/* == Start of generated table == */
+/*
+ * The following tables are generated by running:
+ *
+ *   ./gen-normalization-table.py UnicodeData.txt
+ *
+ * UnicodeData.txt does not have a header.
+ */
+
+#ifndef HB_UNICODE_NORMALIZATION_TABLE_HH
+#define HB_UNICODE_NORMALIZATION_TABLE_HH
+
+#include "hb-unicode.hh"
+
+
+const uint8_t _hb_unicode_normalization_pages[1536] =
+{
+    0,  1,  2,  3,  4,  0,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, /* U+0000 */
+   15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, /* U+0800 */
+   31, 32, 33, 34, 35, 36, 37, 38,  0,  0,  0,  0,  0, 39, 40, 41, /* U+1000 */
+   42, 43, 44, 45, 46, 47, 48, 49, 50, 51,  0, 52, 53, 54, 53, 55, /* U+1800 */
+   56, 57, 58, 59, 60, 61, 62,  0, 63,  0,  0,  0,  0,  0,  0,  0, /* U+2000 */
+    0,  0,  0,  0,  0, 64, 65, 66, 67, 68, 69, 70, 71, 72,  0, 73, /* U+2800 */
+   74, 75, 76, 77, 78, 79,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+3000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+3800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+4000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 80,  0,  0,  0,  0, /* U+4800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+5000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+5800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+6000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+6800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+7000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+7800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+8000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+8800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+9000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 81, /* U+9800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0, 82,  0,  0, 83, 84,  0, 85, /* U+A000 */
+   86, 87, 88, 89, 90, 91, 92, 93, 53, 53, 53, 53, 53, 53, 53, 53, /* U+A800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+B000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+B800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+C000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+C800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 94, /* U+D000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+D800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+E000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+E800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+F000 */
+    0,  0, 53, 53, 95, 53, 96, 97,  0,  0, 98, 99,100,101,102,103, /* U+F800 */
+  104,105,106,107, 53,108,109,110,  0,111,112, 53,  0,  0,113, 53, /* U+10000 */
+  114,115,116,117,118,119,120,121,122,123,124, 53,125, 53,126, 53, /* U+10800 */
+  127,128,129,130,131,132,133, 53,134,135, 53,136,137,138,139, 53, /* U+11000 */
+  140,141, 53, 53,142,143, 53, 53,144,145,146,147, 53,148, 53, 53, /* U+11800 */
+    0,  0,  0,  0,  0,  0,  0,149,150,  0,151, 53, 53, 53, 53, 53, /* U+12000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+12800 */
+    0,  0,  0,  0,  0,  0,  0,  0,152, 53, 53, 53, 53, 53, 53, 53, /* U+13000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+13800 */
+   53, 53, 53, 53, 53, 53, 53, 53,  0,  0,  0,  0,153, 53, 53, 53, /* U+14000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+14800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+15000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+15800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+16000 */
+    0,  0,  0,  0,154,155,156,157, 53, 53, 53, 53,158,159,160,161, /* U+16800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+17000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+17800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,162, /* U+18000 */
+    0,  0,  0,  0,  0,163, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+18800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+19000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+19800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1A000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1A800 */
+    0,  0,164,  0,  0,165, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1B000 */
+   53, 53, 53, 53, 53, 53, 53, 53,166,167, 53, 53, 53, 53, 53, 53, /* U+1B800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1C000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1C800 */
+    0,168,169,170,171,172,173, 53,174,175,176,  0,  0,177,  0,178, /* U+1D000 */
+    0,  0,  0,  0,  0,179, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1D800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1E000 */
+    0,180,181, 53, 53, 53, 53, 53,182,183, 53, 53,184,185, 53, 53, /* U+1E800 */
+  186,187,188,189,190, 53,  0,  0,  0,  0,  0,  0,  0,191,192,193, /* U+1F000 */
+  194,195,196,197,198, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+1F800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+20000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+20800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+21000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+21800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+22000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+22800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+23000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+23800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+24000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+24800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+25000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+25800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+26000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+26800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+27000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+27800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+28000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+28800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+29000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+29800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,199,  0,  0, /* U+2A000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2A800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,200,  0, /* U+2B000 */
+  201,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2B800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2C000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,202,  0,  0, /* U+2C800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2D000 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2D800 */
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, /* U+2E000 */
+    0,  0,  0,  0,  0,  0,  0,203, 53, 53, 53, 53, 53, 53, 53, 53, /* U+2E800 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+2F000 */
+   53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, /* U+2F800 */
+};
+
+const uint32_t _hb_unicode_normalization_blocks[204][4] =
+{
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x3E7EFFBFu, 0xBE7EFFBFu},
+  {0xFFFCFFFFu, 0x7EF1FF3Fu, 0xFFF3F1F8u, 0x7FFFFF3Fu},
+  {0x00000000u, 0x00018003u, 0xDFFFE000u, 0xFF31FFCFu},
+  {0xCFFFFFFFu, 0x000FFFC0u, 0x00000000u, 0x00000000u},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFF7FFFu, 0x4310FFFFu},
+  {0x0001FFEFu, 0x0001FC04u, 0x00187C00u, 0x00000000u},
+  {0x0200708Bu, 0x02000000u, 0x708B0000u, 0x00C00000u},
+  {0x000000F8u, 0x00000000u, 0xFCCF0006u, 0x033FFCFCu},
+  {0x00000000u, 0x00010000u, 0x01800000u, 0x00000000u},
+  {0xFFFF1800u, 0xBFFFFFFFu, 0x0000FFB6u, 0xFFE07800u},
+  {0x27FF0000u, 0x0000007Cu, 0xFFFFF800u, 0x00010000u},
+  {0x00000000u, 0x00000000u, 0x9FC80005u, 0x00003D9Fu},
+  {0x00024000u, 0xFFFF0000u, 0x00001FFFu, 0x00000000u},
+  {0x00000000u, 0xFFFC0000u, 0x00000000u, 0x380FF800u},
+  {0xFBC00000u, 0x8000FEEFu, 0xBE000000u, 0xFFFFF800u},
+  {0xFFFFFFFFu, 0xC0200000u, 0xFFFFFFFFu, 0xFFFFFFFBu},
+  {0x00000000u, 0x10120200u, 0xFF1E2000u, 0x00000000u},
+  {0x00066010u, 0x5C3A0200u, 0xFFFFBE60u, 0xC0000030u},
+  {0x00067811u, 0x3CDA0200u, 0xEFFDE678u, 0xFF80003Fu},
+  {0x00044011u, 0x1C120200u, 0xFFFEE440u, 0x01FC0030u},
+  {0x00066011u, 0x5C120200u, 0x7FFFFF60u, 0xFF000030u},
+  {0x29D23813u, 0x7C0038E7u, 0xFFFEFE38u, 0xF800003Fu},
+  {0x00022000u, 0x1C000200u, 0xF8FFE320u, 0x00FF0030u},
+  {0x00022000u, 0x1C100200u, 0xBFFFEFA5u, 0xFFF90030u},
+  {0x00022010u, 0x58000000u, 0x008F3E20u, 0x00000030u},
+  {0x03800013u, 0xD0040000u, 0xF4A0FF80u, 0xFFE3003Fu},
+  {0x00000001u, 0x7F000000u, 0xF0000F00u, 0xFFFFFFFFu},
+  {0x010FDA69u, 0xC7001351u, 0x0C00CFA0u, 0xFFFFFFFFu},
+  {0x03000000u, 0x02A00000u, 0x10842108u, 0x3D7FE200u},
+  {0x210800DFu, 0x22A01084u, 0xF8002040u, 0xFFFFFFFFu},
+  {0x00000000u, 0x06804040u, 0x00000000u, 0x00000000u},
+  {0x00002000u, 0x00000000u, 0x0000DF40u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x003FFFFEu},
+  {0x00000000u, 0xFFFFFF80u, 0x00000007u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0xC280C200u, 0x00000000u},
+  {0x0000C200u, 0x80C20000u, 0x008000C2u, 0x00000000u},
+  {0x00C20000u, 0x00000000u, 0xF8000000u, 0xE0000000u},
+  {0xFC000000u, 0x00000000u, 0x00000000u, 0xC0C00000u},
+  {0xE0000000u, 0x00000000u, 0x00000000u, 0xFE000000u},
+  {0xFFF02000u, 0xFF900000u, 0xFFF00000u, 0xFFF22000u},
+  {0x00000000u, 0x00000000u, 0xE0040000u, 0xFC00FC00u},
+  {0xFC008000u, 0x00000000u, 0x00000000u, 0xFE000000u},
+  {0x00000000u, 0x0000FA00u, 0x00000000u, 0xFFC00000u},
+  {0x80000000u, 0xFE00F000u, 0x0000000Eu, 0xFFE0C000u},
+  {0x00000000u, 0x0000F000u, 0x3800FC00u, 0x00000000u},
+  {0x31800000u, 0x00000000u, 0x80000000u, 0xFFE00001u},
+  {0xFC00FC00u, 0xBFFFC000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00045540u, 0x28300000u, 0x0000F01Bu, 0xE00FF800u},
+  {0x00000000u, 0x00000C00u, 0x00000000u, 0x0FFC0040u},
+  {0x00000000u, 0x07800000u, 0x00001C00u, 0x00000000u},
+  {0x0000FE00u, 0x18000000u, 0xFFF7FF00u, 0xFF1021FDu},
+  {0x00000000u, 0x00000000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x0BFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x03FFFFFFu},
+  {0xFFFFFFFFu, 0x5FFFFFFFu, 0xFFFFFFFEu, 0xBFFFFFFFu},
+  {0x00000003u, 0x00000000u, 0x00000000u, 0x000C0020u},
+  {0xE0008000u, 0x00000000u, 0x1FFFFFFFu, 0xFFFFFFE2u},
+  {0x00000000u, 0x00000C40u, 0x00000000u, 0x00000000u},
+  {0x0C00F000u, 0x00004000u, 0x0000E000u, 0x00000000u},
+  {0x00001210u, 0x00000050u, 0x00000292u, 0x0333E005u},
+  {0x00000333u, 0x0000F000u, 0x00000000u, 0x00003C0Fu},
+  {0x00000000u, 0x00000600u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0xFFFFFF80u, 0xFFFFF800u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x10000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x00300000u},
+  {0x00C00000u, 0x00000000u, 0x00000200u, 0x80000000u},
+  {0x00000000u, 0x00008000u, 0x80000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x01F38000u},
+  {0x00000000u, 0x0000DF40u, 0x00000000u, 0xFFFE7F00u},
+  {0xFF800000u, 0x80808080u, 0x80808080u, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0xFFFF8000u, 0xFFFFFFFFu},
+  {0x04000000u, 0x00000000u, 0x00000000u, 0xFFF00000u},
+  {0x00000000u, 0x00000000u, 0xFFC00000u, 0xF000FFFFu},
+  {0x00000000u, 0x0000FC00u, 0x55555001u, 0x36DB02A5u},
+  {0x47900000u, 0x55555000u, 0x36DB02A5u, 0x47900000u},
+  {0x0000001Fu, 0x00010000u, 0x00000000u, 0x00000000u},
+  {0x00008000u, 0xF8000000u, 0x00000000u, 0x0000FFF0u},
+  {0x80000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x80000000u},
+  {0x00000000u, 0xFFC00000u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFFF0000u},
+  {0x0000E000u, 0x00000000u, 0x0000FF80u, 0x00000000u},
+  {0x00000000u, 0xFFFFF000u, 0x00000000u, 0x3FF08000u},
+  {0xC0000000u, 0x00000000u, 0x00000000u, 0xFF030000u},
+  {0x00000000u, 0xFC000000u, 0xFFFFFFFFu, 0x007FFFFFu},
+  {0x00000040u, 0xFC00F000u, 0x00000000u, 0xFF000000u},
+  {0x00000000u, 0x00000000u, 0xFC003FD0u, 0x0003FFFFu},
+  {0x00000000u, 0x00003800u, 0x7FF80000u, 0xE0000000u},
+  {0x00000000u, 0x00080000u, 0x3C004001u, 0x80000000u},
+  {0x00000000u, 0xFF800000u, 0x0C00C000u, 0x00000000u},
+  {0x00000000u, 0xC19D0000u, 0x07FFFFFAu, 0xFFC00000u},
+  {0xFF818181u, 0x00008080u, 0x00000000u, 0x0000FFC0u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFC00E000u},
+  {0xFFFFFFFFu, 0x0000FFFFu, 0x00000780u, 0xF0000000u},
+  {0x7FE53FFFu, 0xFFFFFC65u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFF07FF80u, 0xFFFFFC00u, 0x00007FFFu, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x0007FFFCu, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x0000FFFFu, 0x00000000u},
+  {0x00030000u, 0x00000000u, 0xFFFFFF00u, 0xC000FFFFu},
+  {0xFC000000u, 0x0000FFFFu, 0x00080000u, 0x0020F080u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0x60000000u},
+  {0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x80000000u, 0xE3030303u, 0xC1FF8080u},
+  {0x00001000u, 0x48000080u, 0xC000C000u, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xF8000000u},
+  {0x00000078u, 0x00700000u, 0x00000000u, 0x00000000u},
+  {0xF0008000u, 0xFFFFFFFEu, 0x0000FFFFu, 0xE0000000u},
+  {0xE0000000u, 0x00000000u, 0xFFFE0000u, 0xF0000001u},
+  {0x00000000u, 0x00001FF0u, 0x0000F800u, 0xFFC00000u},
+  {0x40000000u, 0x00000000u, 0xFFC000F0u, 0xFFFFFFFFu},
+  {0xC0000000u, 0x0000FC00u, 0x00F00000u, 0xF0000000u},
+  {0x00000000u, 0x0000FF00u, 0x00000000u, 0xFFFF7FF0u},
+  {0x00000000u, 0xFF800000u, 0xFFC00000u, 0xFFFFFF00u},
+  {0x000002C0u, 0x6E400000u, 0x00400000u, 0x00000000u},
+  {0x80000000u, 0xFFFF007Fu, 0xFFFFFFFFu, 0x07C80000u},
+  {0x70000000u, 0x7C000000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x0F000000u, 0x00030000u, 0x00000000u},
+  {0x0110AF90u, 0xFFC00000u, 0xFE00FE00u, 0x00000000u},
+  {0x00000000u, 0xFFFFFFFFu, 0x00000000u, 0xFF8007E0u},
+  {0x00000000u, 0x01C00000u, 0x00C00000u, 0x00F80000u},
+  {0xE1FC0000u, 0xFFFF01FFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0xFFFFFE00u, 0xFFFFFFFFu},
+  {0x00000000u, 0xFFF80000u, 0x00000000u, 0x03F80000u},
+  {0x00000000u, 0xFC00FFF0u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x80000000u},
+  {0x00000000u, 0x0000FF00u, 0xFC01FFC0u, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x0003C040u, 0xFFFF0000u},
+  {0x14000000u, 0x06000800u, 0x0000DFFCu, 0xFC00FE00u},
+  {0x00000007u, 0x0038C080u, 0x0000FF80u, 0xFF880000u},
+  {0x00000000u, 0x00000000u, 0x0000C401u, 0xFFE00001u},
+  {0x00040000u, 0x80600000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x40004280u, 0x0000FC00u, 0x00000000u, 0xFC00FE00u},
+  {0x00066010u, 0x5C120200u, 0x1FFEFE60u, 0xFFFFFFF0u},
+  {0x00000000u, 0x00000000u, 0xD4000044u, 0xFFFFFFFFu},
+  {0x00000000u, 0x7C010000u, 0xFC00FF0Cu, 0xFFFFFFFFu},
+  {0x00000000u, 0x8CC08000u, 0xC0000001u, 0xFFFFFFFFu},
+  {0x00000000u, 0x80000000u, 0xFC00FFE0u, 0xFFFFE000u},
+  {0x00000000u, 0xFFC00000u, 0xFFFFFC00u, 0xFFFFFFFFu},
+  {0x18000000u, 0x0000F800u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0xF6000000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0x00000000u, 0x00000000u, 0x7FF80000u},
+  {0x00000000u, 0x00100000u, 0x0000FF80u, 0x00000000u},
+  {0x02000030u, 0xFFFFFFF8u, 0x00000000u, 0xFE000000u},
+  {0x00000200u, 0x80800000u, 0x0000FFC0u, 0x0000E000u},
+  {0x00030000u, 0xFF800100u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000480u, 0x4B800000u, 0xFC00FF34u, 0x00000240u},
+  {0xFE848000u, 0xFFFFFC00u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFE000000u},
+  {0xFC000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFE08000u},
+  {0x00000000u, 0x00000000u, 0xFFFFFFF0u, 0xFFFFFFFFu},
+  {0x00000000u, 0xFFFF8000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0xFFFFFF80u, 0xFFFFFFFFu},
+  {0x00000000u, 0xFE000000u, 0x80000000u, 0xFFFF3C00u},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000FFFFu, 0xFFDFC000u},
+  {0x00000000u, 0x007F0000u, 0x0400FFC0u, 0x1F000004u},
+  {0xFFFF0000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0x00000000u, 0x00000000u},
+  {0xF8000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x0000FFE0u, 0x80000000u},
+  {0x00007FFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFCu},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFFC0000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFF80000u},
+  {0x80000000u, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0000FFFFu},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xF0000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xE000F800u},
+  {0x4C00FE00u, 0xFFFFFFF0u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFC00000u},
+  {0x00000000u, 0x00000180u, 0xC0000000u, 0xF807E3FFu},
+  {0x00000FE7u, 0xF8003C00u, 0x00000001u, 0xFFFFFE00u},
+  {0x00000000u, 0x00000000u, 0xFFFFFFDCu, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFF00000u},
+  {0x00000000u, 0x00000000u, 0xFF800000u, 0xFE000000u},
+  {0x00000000u, 0x00000000u, 0x00200000u, 0x00000000u},
+  {0x20000000u, 0x1400219Bu, 0x00000010u, 0x00000000u},
+  {0x20201840u, 0x84000000u, 0x000203A0u, 0x00000000u},
+  {0x00000000u, 0x000000C0u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00003000u, 0x00000000u},
+  {0x07FFF000u, 0xFFFF0001u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0xFFFF0060u, 0xFFFFFFFFu},
+  {0x00000000u, 0x00000000u, 0x3C00FFF0u, 0xFFFFFFFFu},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0x0001FFFFu},
+  {0x00000000u, 0xFFE00000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x00000010u, 0xF5080169u, 0x5569157Bu, 0xA1080869u},
+  {0xF0000400u, 0xF0000411u, 0xFFFFFFFFu, 0xFFFCFFFFu},
+  {0x00000000u, 0x0000F000u, 0x00000000u, 0x00000000u},
+  {0xFFF00000u, 0x00018000u, 0x00010001u, 0xFFC00000u},
+  {0x0000E000u, 0x00000000u, 0x00000000u, 0x0000F000u},
+  {0x00000000u, 0xFFFFE000u, 0xFFFFFFFFu, 0x0000003Fu},
+  {0x0000FFF8u, 0xF0000000u, 0xFFFCFE00u, 0xFFFFFFC0u},
+  {0x00000000u, 0x00000000u, 0xFFE00000u, 0xFC00E000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFF00000u},
+  {0x00000000u, 0x00000000u, 0xFE000000u, 0xFFFFFFFFu},
+  {0x0000F000u, 0x00000000u, 0xFC00FF00u, 0x00000000u},
+  {0x0000FF00u, 0xFFFFC000u, 0xFFFFFFFFu, 0xFFFFFFFFu},
+  {0x0000F000u, 0x80000000u, 0x00000000u, 0x0B860000u},
+  {0x00000000u, 0xFC00FFF8u, 0x0000FFF8u, 0x00000000u},
+  {0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFFFFFu, 0xFFFFC000u},
+  {0x00000000u, 0x00000000u, 0xFF800000u, 0xFFFFFFFFu},
+  {0x00000000u, 0xFFE00000u, 0x00000000u, 0x00000000u},
+  {0xC0000000u, 0x00000000u, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x0000FFFCu, 0x00000000u, 0x00000000u},
+  {0x00000000u, 0x00000000u, 0x00000000u, 0xFFFFFFFEu},
+};
+
+#endif /* HB_UNICODE_NORMALIZATION_TABLE_HH */
+
+/* == End of generated table == */
@@ -108,6 +108,24 @@ hb_unicode_decompose_compatibility_nil (hb_unicode_funcs_t *ufuncs     HB_UNUSED
   return 0;
 }
 
+#define HB_UNICODE_FUNC_IMPLEMENT(return_type, name, batch_name)		\
+										\
+static void									\
+hb_unicode_##batch_name##_nil (hb_unicode_funcs_t   *ufuncs,			\
+			       unsigned int          count,			\
+			       const hb_codepoint_t *first_unicode,		\
+			       unsigned int          unicode_stride,		\
+			       return_type          *first_value,		\
+			       unsigned int          value_stride,		\
+			       void                 *user_data HB_UNUSED)	\
+{										\
+  ufuncs->batch_name##_one_by_one (count,					\
+				   first_unicode, unicode_stride,		\
+				   first_value, value_stride);			\
+}
+HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_BATCH
+#undef HB_UNICODE_FUNC_IMPLEMENT
+
 
 #define HB_UNICODE_FUNCS_IMPLEMENT_SET \
   HB_UNICODE_FUNCS_IMPLEMENT (glib) \
@@ -181,6 +199,9 @@ hb_unicode_funcs_create (hb_unicode_funcs_t *parent)
    * though. */
   ufuncs->user_data = parent->user_data;
 
+  ufuncs->canonical = parent->canonical;
+  ufuncs->tabled = parent->tabled;
+
   return ufuncs;
 }
 
@@ -195,7 +216,19 @@ DEFINE_NULL_INSTANCE (hb_unicode_funcs_t) =
 #define HB_UNICODE_FUNC_IMPLEMENT(name) hb_unicode_##name##_nil,
     HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
 #undef HB_UNICODE_FUNC_IMPLEMENT
-  }
+  },
+  {
+#define HB_UNICODE_FUNC_IMPLEMENT(name) nullptr,
+    HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
+#undef HB_UNICODE_FUNC_IMPLEMENT
+  }, /* user_data */
+  {
+#define HB_UNICODE_FUNC_IMPLEMENT(name) nullptr,
+    HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
+#undef HB_UNICODE_FUNC_IMPLEMENT
+  }, /* destroy */
+  {nullptr, nullptr}, /* canonical */
+  {nullptr, nullptr} /* tabled */
 };
 
 /**
@@ -387,6 +420,23 @@ hb_unicode_##name (hb_unicode_funcs_t *ufuncs,					\
 HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
 #undef HB_UNICODE_FUNC_IMPLEMENT
 
+#define HB_UNICODE_FUNC_IMPLEMENT(return_type, name, batch_name)		\
+										\
+void										\
+hb_unicode_##batch_name (hb_unicode_funcs_t   *ufuncs,				\
+			 unsigned int          count,				\
+			 const hb_codepoint_t *first_unicode,			\
+			 unsigned int          unicode_stride,			\
+			 return_type          *first_##name,			\
+			 unsigned int          name##_stride)			\
+{										\
+  ufuncs->batch_name (count,							\
+		      first_unicode, unicode_stride,				\
+		      first_##name, name##_stride);				\
+}
+HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_BATCH
+#undef HB_UNICODE_FUNC_IMPLEMENT
+
 /**
  * hb_unicode_compose:
  * @ufuncs: Unicode functions.
@@ -566,6 +616,20 @@ _hb_modified_combining_class[256] =
 };
 
 
+/*
+ * Normalization
+ */
+
+#include "hb-unicode-normalization-table.hh"
+
+
+/*
+ * Properties
+ */
+
+#include "hb-unicode-props-table.hh"
+
+
 /*
  * Emoji
  */
@@ -251,6 +251,22 @@ typedef hb_bool_t			(*hb_unicode_decompose_func_t)		(hb_unicode_funcs_t *ufuncs,
 										 hb_codepoint_t     *b,
 										 void               *user_data);
 
+typedef void (*hb_unicode_general_categories_func_t) (hb_unicode_funcs_t *ufuncs,
+						      unsigned int count,
+						      const hb_codepoint_t *first_unicode,
+						      unsigned int unicode_stride,
+						      hb_unicode_general_category_t *first_category,
+						      unsigned int category_stride,
+						      void *user_data);
+
+typedef void (*hb_unicode_scripts_func_t) (hb_unicode_funcs_t *ufuncs,
+					   unsigned int count,
+					   const hb_codepoint_t *first_unicode,
+					   unsigned int unicode_stride,
+					   hb_script_t *first_script,
+					   unsigned int script_stride,
+					   void *user_data);
+
 /* setters */
 
 /**
@@ -349,6 +365,43 @@ hb_unicode_funcs_set_decompose_func (hb_unicode_funcs_t *ufuncs,
 				     hb_unicode_decompose_func_t func,
 				     void *user_data, hb_destroy_func_t destroy);
 
+/**
+ * hb_unicode_funcs_set_general_categories_func:
+ * @ufuncs: a Unicode function structure
+ * @func: (closure user_data) (destroy destroy) (scope notified):
+ * @user_data:
+ * @destroy:
+ *
+ * Sets the function used to look up the general categories of many
+ * characters at once.  It must give the same answers as the
+ * general_category function; by default, that is called for each
+ * character.
+ *
+ * Since: REPLACEME
+ **/
+HB_EXTERN void
+hb_unicode_funcs_set_general_categories_func (hb_unicode_funcs_t *ufuncs,
+					      hb_unicode_general_categories_func_t func,
+					      void *user_data, hb_destroy_func_t destroy);
+
+/**
+ * hb_unicode_funcs_set_scripts_func:
+ * @ufuncs: a Unicode function structure
+ * @func: (closure user_data) (destroy destroy) (scope notified):
+ * @user_data:
+ * @destroy:
+ *
+ * Sets the function used to look up the scripts of many characters at
+ * once.  It must give the same answers as the script function; by
+ * default, that is called for each character.
+ *
+ * Since: REPLACEME
+ **/
+HB_EXTERN void
+hb_unicode_funcs_set_scripts_func (hb_unicode_funcs_t *ufuncs,
+				   hb_unicode_scripts_func_t func,
+				   void *user_data, hb_destroy_func_t destroy);
+
 /* accessors */
 
 /**
@@ -387,6 +440,44 @@ HB_EXTERN hb_script_t
 hb_unicode_script (hb_unicode_funcs_t *ufuncs,
 		   hb_codepoint_t unicode);
 
+/**
+ * hb_unicode_general_categories:
+ * @ufuncs: Unicode functions.
+ * @count: number of code points.
+ * @first_unicode: first code point.
+ * @unicode_stride: bytes from one code point to the next.
+ * @first_category: (out): where to put the first general category.
+ * @category_stride: bytes from one general category to the next.
+ *
+ * Since: REPLACEME
+ **/
+HB_EXTERN void
+hb_unicode_general_categories (hb_unicode_funcs_t *ufuncs,
+			       unsigned int count,
+			       const hb_codepoint_t *first_unicode,
+			       unsigned int unicode_stride,
+			       hb_unicode_general_category_t *first_category,
+			       unsigned int category_stride);
+
+/**
+ * hb_unicode_scripts:
+ * @ufuncs: Unicode functions.
+ * @count: number of code points.
+ * @first_unicode: first code point.
+ * @unicode_stride: bytes from one code point to the next.
+ * @first_script: (out): where to put the first script.
+ * @script_stride: bytes from one script to the next.
+ *
+ * Since: REPLACEME
+ **/
+HB_EXTERN void
+hb_unicode_scripts (hb_unicode_funcs_t *ufuncs,
+		    unsigned int count,
+		    const hb_codepoint_t *first_unicode,
+		    unsigned int unicode_stride,
+		    hb_script_t *first_script,
+		    unsigned int script_stride);
+
 HB_EXTERN hb_bool_t
 hb_unicode_compose (hb_unicode_funcs_t *ufuncs,
 		    hb_codepoint_t      a,
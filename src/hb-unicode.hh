@@ -36,6 +36,42 @@
 
 extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
 
+/* Whether canonical normalization can touch a code point: it has a
+ * canonical decomposition, can be the second half of a canonical
+ * composition, or has a non-zero combining class.  Unassigned code points,
+ * and everything past U+2FFFF, are flagged too.  Generated by
+ * gen-normalization-table.py; in hb-unicode.cc. */
+extern HB_INTERNAL const uint8_t _hb_unicode_normalization_pages[0x30000 >> 7];
+extern HB_INTERNAL const uint32_t _hb_unicode_normalization_blocks[][4];
+
+static inline bool
+_hb_unicode_normalization_flagged (hb_codepoint_t u)
+{
+  if (unlikely (u >= 0x30000u)) return true;
+  return (_hb_unicode_normalization_blocks[_hb_unicode_normalization_pages[u >> 7]][(u >> 5) & 3] >> (u & 31)) & 1;
+}
+
+/* General category, Default_Ignorable and canonical combining class of
+ * every code point, packed per HB_UNICODE_PROPS_*, from the Unicode data
+ * UCDN carries.  Default_Ignorable follows is_default_ignorable(), and so
+ * does not depend on the Unicode implementation.  Generated by
+ * gen-unicode-props-table.py; in hb-unicode.cc. */
+enum {
+  HB_UNICODE_PROPS_GEN_CAT	= 0x001Fu,
+  HB_UNICODE_PROPS_IGNORABLE	= 0x0020u,
+  HB_UNICODE_PROPS_CCC_SHIFT	= 8
+};
+extern HB_INTERNAL const uint8_t _hb_unicode_props_pages[0x110000 >> 7];
+extern HB_INTERNAL const uint8_t _hb_unicode_props_blocks[][128];
+extern HB_INTERNAL const uint16_t _hb_unicode_props_records[];
+
+static inline unsigned int
+_hb_unicode_props (hb_codepoint_t u)
+{
+  if (unlikely (u >= 0x110000u)) return _hb_unicode_props_records[0];
+  return _hb_unicode_props_records[_hb_unicode_props_blocks[_hb_unicode_props_pages[u >> 7]][u & 127]];
+}
+
 /*
  * hb_unicode_funcs_t
  */
@@ -49,6 +85,8 @@ extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
   HB_UNICODE_FUNC_IMPLEMENT (compose) \
   HB_UNICODE_FUNC_IMPLEMENT (decompose) \
   HB_UNICODE_FUNC_IMPLEMENT (decompose_compatibility) \
+  HB_UNICODE_FUNC_IMPLEMENT (general_categories) \
+  HB_UNICODE_FUNC_IMPLEMENT (scripts) \
   /* ^--- Add new callbacks here */
 
 /* Simple callbacks are those taking a hb_codepoint_t and returning a hb_codepoint_t */
@@ -60,6 +98,13 @@ extern HB_INTERNAL const uint8_t _hb_modified_combining_class[256];
   HB_UNICODE_FUNC_IMPLEMENT (hb_script_t, script) \
   /* ^--- Add new simple callbacks here */
 
+/* Batch callbacks are those filling an array from an array of code points,
+ * each batching a simple callback */
+#define HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_BATCH \
+  HB_UNICODE_FUNC_IMPLEMENT (hb_unicode_general_category_t, general_category, general_categories) \
+  HB_UNICODE_FUNC_IMPLEMENT (hb_script_t, script, scripts) \
+  /* ^--- Add new batch callbacks here */
+
 struct hb_unicode_funcs_t
 {
   hb_object_header_t header;
@@ -72,6 +117,36 @@ struct hb_unicode_funcs_t
 #define HB_UNICODE_FUNC_IMPLEMENT(return_type, name) \
   inline return_type name (hb_codepoint_t unicode) { return func.name (this, unicode, user_data.name); }
 HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
+#undef HB_UNICODE_FUNC_IMPLEMENT
+
+  /* The _one_by_one() variants call the simple callback for each code
+   * point, which is what the batch callbacks do by default. */
+#define HB_UNICODE_FUNC_IMPLEMENT(return_type, name, batch_name) \
+  inline void batch_name (unsigned int count, \
+			  const hb_codepoint_t *first_unicode, \
+			  unsigned int unicode_stride, \
+			  return_type *first_value, \
+			  unsigned int value_stride) \
+  { \
+    func.batch_name (this, count, \
+		     first_unicode, unicode_stride, \
+		     first_value, value_stride, \
+		     user_data.batch_name); \
+  } \
+  inline void batch_name##_one_by_one (unsigned int count, \
+				       const hb_codepoint_t *first_unicode, \
+				       unsigned int unicode_stride, \
+				       return_type *first_value, \
+				       unsigned int value_stride) \
+  { \
+    for (unsigned int i = 0; i < count; i++) \
+    { \
+      *first_value = name (*first_unicode); \
+      first_unicode = (const hb_codepoint_t *) ((const char *) first_unicode + unicode_stride); \
+      first_value = (return_type *) ((char *) first_value + value_stride); \
+    } \
+  }
+HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_BATCH
 #undef HB_UNICODE_FUNC_IMPLEMENT
 
   inline hb_bool_t compose (hb_codepoint_t a, hb_codepoint_t b,
@@ -79,6 +154,7 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
   {
     *ab = 0;
     if (unlikely (!a || !b)) return false;
+    if (func.compose == canonical.compose && !_hb_unicode_normalization_flagged (b)) return false;
     return func.compose (this, a, b, ab, user_data.compose);
   }
 
@@ -86,6 +162,7 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
 			      hb_codepoint_t *a, hb_codepoint_t *b)
   {
     *a = ab; *b = 0;
+    if (func.decompose == canonical.decompose && !_hb_unicode_normalization_flagged (ab)) return false;
     return func.decompose (this, ab, a, b, user_data.decompose);
   }
 
@@ -117,7 +194,17 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
     /* Reorder TSA -PHRU to reorder before U+0F74 */
     if (unlikely (u == 0x0F39u)) return 127;
 
-    return _hb_modified_combining_class[combining_class (u)];
+    return _hb_modified_combining_class[has_props_table () ?
+					_hb_unicode_props (u) >> HB_UNICODE_PROPS_CCC_SHIFT :
+					(unsigned int) combining_class (u)];
+  }
+
+  /* Whether _hb_unicode_props() answers for the general_category and
+   * combining_class callbacks. */
+  inline bool has_props_table (void) const
+  {
+    return func.general_category == tabled.general_category &&
+	   func.combining_class == tabled.combining_class;
   }
 
   static inline hb_bool_t
@@ -262,6 +349,22 @@ HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS_SIMPLE
     HB_UNICODE_FUNCS_IMPLEMENT_CALLBACKS
 #undef HB_UNICODE_FUNC_IMPLEMENT
   } destroy;
+
+  /* The compose and decompose callbacks of the built-in implementations,
+   * which follow the Unicode data.  While they are the ones installed,
+   * compose() and decompose() skip calling them for characters that
+   * _hb_unicode_normalization_flagged() rules out. */
+  struct {
+    hb_unicode_compose_func_t compose;
+    hb_unicode_decompose_func_t decompose;
+  } canonical;
+
+  /* The general_category and combining_class callbacks of the UCDN
+   * implementation, whose data _hb_unicode_props() was generated from. */
+  struct {
+    hb_unicode_general_category_func_t general_category;
+    hb_unicode_combining_class_func_t combining_class;
+  } tabled;
 };
 DECLARE_NULL_INSTANCE (hb_unicode_funcs_t);
 
@@ -369,7 +472,7 @@ DECLARE_NULL_INSTANCE (hb_unicode_funcs_t);
 struct hb_unicode_range_t
 {
   static int
-  cmp (const void *_key, const void *_item, void *_arg)
+  cmp (const void *_key, const void *_item, void *_arg HB_UNUSED)
   {
     hb_codepoint_t cp = *((hb_codepoint_t *) _key);
     const hb_unicode_range_t *range = (hb_unicode_range_t *) _item;
@@ -120,6 +120,27 @@ struct hb_utf8_t
     return end - 1;
   }
 
+  /* Returns how many code units from text on are ASCII, and so each a
+   * code point by itself. */
+  static inline unsigned int
+  simple_run (const uint8_t *text,
+	      const uint8_t *end)
+  {
+    const uint8_t *p = text;
+    if (*p > 0x7Fu) return 0;
+#if defined(HB_SIMD_SSE2)
+    for (; end - p >= 16; p += 16)
+    {
+      unsigned int m = _mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *) p));
+      if (m)
+	return p - text + hb_ctz (m);
+    }
+#endif
+    while (p < end && *p <= 0x7Fu)
+      p++;
+    return p - text;
+  }
+
   static inline unsigned int
   strlen (const uint8_t *text)
   {
@@ -196,6 +217,30 @@ struct hb_utf16_t
     return text;
   }
 
+  /* Returns how many code units from text on are not surrogates, and so
+   * each a code point by itself. */
+  static inline unsigned int
+  simple_run (const uint16_t *text,
+	      const uint16_t *end)
+  {
+    const uint16_t *p = text;
+    if ((*p & 0xF800u) == 0xD800u) return 0;
+#if defined(HB_SIMD_SSE2)
+    const __m128i mask = _mm_set1_epi16 ((short) 0xF800u);
+    const __m128i surrogate = _mm_set1_epi16 ((short) 0xD800u);
+    for (; end - p >= 8; p += 8)
+    {
+      __m128i x = _mm_and_si128 (_mm_loadu_si128 ((const __m128i *) p), mask);
+      unsigned int m = _mm_movemask_epi8 (_mm_cmpeq_epi16 (x, surrogate));
+      if (m)
+	return p - text + hb_ctz (m) / 2;
+    }
+#endif
+    while (p < end && (*p & 0xF800u) != 0xD800u)
+      p++;
+    return p - text;
+  }
+
 
   static inline unsigned int
   strlen (const uint16_t *text)
@@ -236,6 +281,19 @@ struct hb_utf32_t
     return text;
   }
 
+  /* Returns how many code units from text on are valid code points. */
+  static inline unsigned int
+  simple_run (const uint32_t *text,
+	      const uint32_t *end)
+  {
+    if (!validate)
+      return end - text;
+    const uint32_t *p = text;
+    while (p < end && !(*p >= 0xD800u && (*p <= 0xDFFFu || *p > 0x10FFFFu)))
+      p++;
+    return p - text;
+  }
+
   static inline unsigned int
   strlen (const uint32_t *text)
   {
@@ -270,6 +328,14 @@ struct hb_latin1_t
     return text;
   }
 
+  /* Every byte is a code point by itself. */
+  static inline unsigned int
+  simple_run (const uint8_t *text,
+	      const uint8_t *end)
+  {
+    return end - text;
+  }
+
   static inline unsigned int
   strlen (const uint8_t *text)
   {
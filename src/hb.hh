@@ -61,6 +61,13 @@
 #include <intrin.h>
 #endif
 
+/* SSE2 is part of the baseline of x86-64; use it where the compiler
+ * targets it.  Define HB_NO_SIMD to disable it. */
+#if !defined(HB_NO_SIMD) && defined(__GNUC__) && defined(__SSE2__)
+#define HB_SIMD_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #define HB_PASTE1(a,b) a##b
 #define HB_PASTE(a,b) HB_PASTE1(a,b)
 
@@ -160,6 +160,9 @@ typedef void (*hb_test_fixture_func_t) (void);
 #if !GLIB_CHECK_VERSION(2,30,0)
 #define g_test_fail() g_error("Test failed")
 #endif
+#if !GLIB_CHECK_VERSION(2,38,0)
+#define g_test_skip(msg) g_test_message ("SKIP: %s", msg)
+#endif
 #ifndef g_assert_true
 #define g_assert_true g_assert
 #endif
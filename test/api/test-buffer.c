@@ -810,6 +810,63 @@ test_buffer_utf32_conversion (void)
   hb_buffer_destroy (b);
 }
 
+/* Long texts, to cover the bulk copy of runs of ASCII and of BMP
+ * code units, with the odd sequence that needs decoding in between. */
+static void
+test_buffer_utf_long_runs (void)
+{
+  hb_buffer_t *b;
+  char utf8[1001];
+  uint16_t utf16[1001];
+  hb_glyph_info_t *glyphs;
+  unsigned int i, len;
+
+  b = hb_buffer_create ();
+  hb_buffer_set_replacement_codepoint (b, (hb_codepoint_t) -1);
+
+  for (i = 0; i < 1000; i++)
+    utf8[i] = 'a' + i % 26;
+  utf8[1000] = '\0';
+  /* U+00E9 at 15, U+4E8C at 255, an invalid byte at 511. */
+  utf8[15] = '\xC3'; utf8[16] = '\xA9';
+  utf8[255] = '\xE4'; utf8[256] = '\xBA'; utf8[257] = '\x8C';
+  utf8[511] = '\xFF';
+
+  hb_buffer_add_utf8 (b, utf8, -1, 0, -1);
+  glyphs = hb_buffer_get_glyph_infos (b, &len);
+  g_assert_cmpint (len, ==, 1000 - 1 - 2);
+  for (i = 0; i < len; i++)
+  {
+    unsigned int cluster = i < 16 ? i : i < 255 ? i + 1 : i + 3;
+    hb_codepoint_t u = cluster == 15 ? 0x00E9 : cluster == 255 ? 0x4E8C :
+		       cluster == 511 ? (hb_codepoint_t) -1 : 'a' + cluster % 26;
+    g_assert_cmpint (glyphs[i].cluster, ==, cluster);
+    g_assert_cmphex (glyphs[i].codepoint, ==, u);
+    g_assert_cmphex (glyphs[i].mask, ==, 0);
+  }
+
+  for (i = 0; i < 1000; i++)
+    utf16[i] = 0x4E00 + i;
+  utf16[1000] = 0;
+  /* U+10302 at 7, a lone low surrogate at 300. */
+  utf16[7] = 0xD800; utf16[8] = 0xDF02;
+  utf16[300] = 0xDC00;
+
+  hb_buffer_clear_contents (b);
+  hb_buffer_add_utf16 (b, utf16, -1, 0, -1);
+  glyphs = hb_buffer_get_glyph_infos (b, &len);
+  g_assert_cmpint (len, ==, 1000 - 1);
+  for (i = 0; i < len; i++)
+  {
+    unsigned int cluster = i < 8 ? i : i + 1;
+    hb_codepoint_t u = cluster == 7 ? 0x10302 : cluster == 300 ? (hb_codepoint_t) -1 : 0x4E00 + cluster;
+    g_assert_cmpint (glyphs[i].cluster, ==, cluster);
+    g_assert_cmphex (glyphs[i].codepoint, ==, u);
+  }
+
+  hb_buffer_destroy (b);
+}
+
 
 static void
 test_empty (hb_buffer_t *b)
@@ -819,6 +876,103 @@ test_empty (hb_buffer_t *b)
   g_assert (!hb_buffer_get_glyph_positions (b, NULL));
 }
 
+static void
+test_buffer_pool (void)
+{
+  hb_buffer_pool_t *pool = hb_buffer_pool_create ();
+  hb_buffer_t *a, *b, *c;
+  hb_glyph_info_t *info;
+  unsigned int len;
+
+  a = hb_buffer_create ();
+  g_assert (!hb_buffer_get_pool (a));
+  hb_buffer_set_pool (a, pool);
+  g_assert (hb_buffer_get_pool (a) == pool);
+  hb_buffer_add_utf32 (a, utf32, G_N_ELEMENTS (utf32), 0, -1);
+  info = hb_buffer_get_glyph_infos (a, NULL);
+
+  /* The pool stays attached across resets. */
+  hb_buffer_reset (a);
+  g_assert (hb_buffer_get_pool (a) == pool);
+  hb_buffer_destroy (a);
+
+  /* A new buffer picks up the storage the first one gave back. */
+  b = hb_buffer_create ();
+  hb_buffer_set_pool (b, pool);
+  hb_buffer_add_utf32 (b, utf32, G_N_ELEMENTS (utf32), 0, -1);
+  g_assert (hb_buffer_get_glyph_infos (b, &len) == info);
+  g_assert_cmpint (len, ==, G_N_ELEMENTS (utf32));
+  g_assert_cmphex (hb_buffer_get_glyph_infos (b, NULL)[0].codepoint, ==, utf32[0]);
+
+  /* Two buffers were never out at once; trimming keeps enough for one. */
+  c = hb_buffer_create ();
+  hb_buffer_set_pool (c, pool);
+  hb_buffer_add_utf32 (c, utf32, G_N_ELEMENTS (utf32), 0, -1);
+  g_assert (hb_buffer_get_glyph_infos (c, NULL) != info);
+  hb_buffer_destroy (b);
+  hb_buffer_destroy (c);
+  hb_buffer_pool_trim (pool);
+  hb_buffer_pool_trim (pool);
+
+  /* Buffers hold a reference to their pool. */
+  a = hb_buffer_create ();
+  hb_buffer_set_pool (a, pool);
+  hb_buffer_pool_destroy (pool);
+  hb_buffer_add_utf32 (a, utf32, G_N_ELEMENTS (utf32), 0, -1);
+  hb_buffer_set_pool (a, NULL);
+  g_assert (!hb_buffer_get_pool (a));
+  hb_buffer_destroy (a);
+
+  pool = hb_buffer_pool_create ();
+  hb_buffer_set_pool (hb_buffer_get_empty (), pool);
+  g_assert (!hb_buffer_get_pool (hb_buffer_get_empty ()));
+  hb_buffer_pool_destroy (pool);
+}
+
+static void
+test_buffer_arena (void)
+{
+  hb_glyph_info_t arena[20];
+  hb_buffer_t *b = hb_buffer_create ();
+  hb_glyph_info_t *info;
+  unsigned int len, i;
+
+  g_assert (!hb_buffer_set_arena (b, arena, sizeof (arena[0])));
+  g_assert (hb_buffer_set_arena (b, arena, sizeof (arena)));
+
+  /* Room for ten glyphs; the text fits. */
+  hb_buffer_add_utf32 (b, utf32, 5, 0, -1);
+  g_assert (hb_buffer_allocation_successful (b));
+  info = hb_buffer_get_glyph_infos (b, &len);
+  g_assert_cmpint (len, ==, 5);
+  g_assert (info >= arena && info + len <= arena + G_N_ELEMENTS (arena));
+
+  g_assert (!hb_buffer_set_arena (b, NULL, 0));
+
+  /* Outgrowing the arena moves the contents out of it. */
+  for (i = 0; i < 4; i++)
+    hb_buffer_add_utf32 (b, utf32, G_N_ELEMENTS (utf32), 0, -1);
+  g_assert (hb_buffer_allocation_successful (b));
+  info = hb_buffer_get_glyph_infos (b, &len);
+  g_assert_cmpint (len, ==, 5 + 4 * G_N_ELEMENTS (utf32));
+  g_assert (info < arena || info >= arena + G_N_ELEMENTS (arena));
+  for (i = 0; i < 5; i++)
+    g_assert_cmphex (info[i].codepoint, ==, utf32[i]);
+  for (i = 5; i < len; i++)
+    g_assert_cmphex (info[i].codepoint, ==, utf32[(i - 5) % G_N_ELEMENTS (utf32)]);
+
+  /* And the arena can be used again once the buffer is empty. */
+  hb_buffer_clear_contents (b);
+  g_assert (hb_buffer_set_arena (b, arena, sizeof (arena)));
+  hb_buffer_add_utf32 (b, utf32, 5, 0, -1);
+  g_assert (hb_buffer_get_glyph_infos (b, NULL) >= arena);
+  hb_buffer_clear_contents (b);
+  g_assert (hb_buffer_set_arena (b, NULL, 0));
+  test_empty (b);
+
+  hb_buffer_destroy (b);
+}
+
 static void
 test_buffer_empty (void)
 {
@@ -878,7 +1032,10 @@ main (int argc, char **argv)
   hb_test_add (test_buffer_utf8_validity);
   hb_test_add (test_buffer_utf16_conversion);
   hb_test_add (test_buffer_utf32_conversion);
+  hb_test_add (test_buffer_utf_long_runs);
   hb_test_add (test_buffer_empty);
+  hb_test_add (test_buffer_pool);
+  hb_test_add (test_buffer_arena);
 
   return hb_test_run();
 }
@@ -531,6 +531,52 @@ test_font_properties (void)
   hb_font_destroy (subfont);
 }
 
+static void
+test_font_advance_cache (void)
+{
+  /* The font's HVAR varies the advance of "$" along wght. */
+  gchar *path = g_test_build_filename (G_TEST_DIST, "fonts/AdobeVFPrototype-Subset.otf", NULL);
+  hb_blob_t *blob = hb_blob_create_from_file (path);
+  hb_face_t *face = hb_face_create (blob, 0);
+  hb_font_t *font = hb_font_create (face);
+  int coords[1] = {0};
+  int light_coords[1] = {-0x4000};
+  hb_codepoint_t glyph;
+  hb_position_t advance, light_advance;
+
+  g_free (path);
+  hb_blob_destroy (blob);
+  hb_face_destroy (face);
+
+  g_assert (hb_font_get_nominal_glyph (font, '$', &glyph));
+
+  /* Instances cache their advances; changing the coords must drop them. */
+  hb_font_set_var_coords_normalized (font, coords, 1);
+  advance = hb_font_get_glyph_h_advance (font, glyph);
+  g_assert_cmpint (advance, >, 0);
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, advance);
+
+  hb_font_set_var_coords_normalized (font, light_coords, 1);
+  light_advance = hb_font_get_glyph_h_advance (font, glyph);
+  g_assert_cmpint (light_advance, >, 0);
+  g_assert_cmpint (light_advance, !=, advance);
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, light_advance);
+
+  hb_font_set_var_coords_normalized (font, coords, 1);
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, advance);
+  hb_font_set_var_coords_normalized (font, light_coords, 1);
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, light_advance);
+
+  /* And so must changing the scale. */
+  hb_font_set_scale (font, 2 * hb_face_get_upem (face), 2 * hb_face_get_upem (face));
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, 2 * light_advance);
+  hb_font_set_scale (font, -(int) hb_face_get_upem (face), hb_face_get_upem (face));
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, -light_advance);
+  g_assert_cmpint (hb_font_get_glyph_h_advance (font, glyph), ==, -light_advance);
+
+  hb_font_destroy (font);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -546,6 +592,7 @@ main (int argc, char **argv)
 
   hb_test_add (test_font_empty);
   hb_test_add (test_font_properties);
+  hb_test_add (test_font_advance_cache);
 
   return hb_test_run();
 }
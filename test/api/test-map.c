@@ -0,0 +1,144 @@
+/*
+ * Copyright © 2013  Google, Inc.
+ *
+ *  This is part of HarfBuzz, a text shaping library.
+ *
+ * Permission is hereby granted, without written agreement and without
+ * license or royalty fees, to use, copy, modify, and distribute this
+ * software and its documentation for any purpose, provided that the
+ * above copyright notice and the following two paragraphs appear in
+ * all copies of this software.
+ *
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE TO ANY PARTY FOR
+ * DIRECT, INDIRECT, SPECIAL, INCIDENTAL, OR CONSEQUENTIAL DAMAGES
+ * ARISING OUT OF THE USE OF THIS SOFTWARE AND ITS DOCUMENTATION, EVEN
+ * IF THE COPYRIGHT HOLDER HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH
+ * DAMAGE.
+ *
+ * THE COPYRIGHT HOLDER SPECIFICALLY DISCLAIMS ANY WARRANTIES, INCLUDING,
+ * BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND
+ * FITNESS FOR A PARTICULAR PURPOSE.  THE SOFTWARE PROVIDED HEREUNDER IS
+ * ON AN "AS IS" BASIS, AND THE COPYRIGHT HOLDER HAS NO OBLIGATION TO
+ * PROVIDE MAINTENANCE, SUPPORT, UPDATES, ENHANCEMENTS, OR MODIFICATIONS.
+ *
+ * Google Author(s): Behdad Esfahbod
+ */
+
+#include "hb-test.h"
+
+/* Unit tests for hb-map.h */
+
+
+static void
+test_map_basic (void)
+{
+  hb_map_t *m = hb_map_create ();
+
+  g_assert (hb_map_allocation_successful (m));
+  g_assert (hb_map_is_empty (m));
+  g_assert_cmpint (hb_map_get_population (m), ==, 0);
+  g_assert_cmpint (hb_map_get (m, 10), ==, HB_MAP_VALUE_INVALID);
+  g_assert (!hb_map_has (m, 10));
+
+  hb_map_clear (m);
+  g_assert (hb_map_is_empty (m));
+
+  hb_map_set (m, 10, 20);
+  hb_map_set (m, 11, 22);
+  g_assert (!hb_map_is_empty (m));
+  g_assert_cmpint (hb_map_get_population (m), ==, 2);
+  g_assert_cmpint (hb_map_get (m, 10), ==, 20);
+  g_assert_cmpint (hb_map_get (m, 11), ==, 22);
+  g_assert (!hb_map_has (m, 12));
+
+  hb_map_set (m, 10, 30);
+  g_assert_cmpint (hb_map_get (m, 10), ==, 30);
+  g_assert_cmpint (hb_map_get_population (m), ==, 2);
+
+  hb_map_del (m, 10);
+  g_assert (!hb_map_has (m, 10));
+  g_assert_cmpint (hb_map_get_population (m), ==, 1);
+  hb_map_del (m, 12345);
+  g_assert_cmpint (hb_map_get_population (m), ==, 1);
+
+  hb_map_clear (m);
+  g_assert (hb_map_is_empty (m));
+  g_assert (!hb_map_has (m, 11));
+
+  hb_map_destroy (m);
+}
+
+static void
+test_map_dense_and_sparse (void)
+{
+  hb_map_t *m = hb_map_create ();
+  unsigned int i;
+
+  /* Small keys are stored at their own index... */
+  for (i = 0; i < 100; i++)
+    hb_map_set (m, i, i * 3);
+  hb_map_del (m, 50);
+  for (i = 0; i < 100; i++)
+    g_assert_cmpint (hb_map_get (m, i), ==, i == 50 ? HB_MAP_VALUE_INVALID : i * 3);
+  g_assert (!hb_map_has (m, 100));
+  g_assert (!hb_map_has (m, 100000));
+
+  /* ...until a key that does not fit comes along. */
+  hb_map_set (m, 100000, 7);
+  hb_map_set (m, 50, 8);
+  g_assert_cmpint (hb_map_get_population (m), ==, 101);
+  for (i = 0; i < 100; i++)
+    g_assert_cmpint (hb_map_get (m, i), ==, i == 50 ? 8 : i * 3);
+  g_assert_cmpint (hb_map_get (m, 100000), ==, 7);
+  g_assert (!hb_map_has (m, 100001));
+
+  for (i = 0; i < 1000; i++)
+    hb_map_set (m, 0x10000 + i * 977, i);
+  for (i = 0; i < 1000; i++)
+    g_assert_cmpint (hb_map_get (m, 0x10000 + i * 977), ==, i);
+  g_assert_cmpint (hb_map_get_population (m), ==, 1101);
+
+  hb_map_destroy (m);
+}
+
+static void
+test_map_keys (void)
+{
+  hb_map_t *m = hb_map_create ();
+  hb_set_t *s = hb_set_create ();
+  hb_codepoint_t k = HB_SET_VALUE_INVALID;
+
+  hb_map_keys (m, s);
+  g_assert (hb_set_is_empty (s));
+
+  hb_map_set (m, 70000, 1);
+  hb_map_set (m, 5, 2);
+  hb_map_set (m, 300, 3);
+  hb_map_set (m, 6, 4);
+  hb_map_del (m, 6);
+
+  hb_map_keys (m, s);
+  g_assert_cmpint (hb_set_get_population (s), ==, 3);
+  g_assert (hb_set_next (s, &k));
+  g_assert_cmpint (k, ==, 5);
+  g_assert (hb_set_next (s, &k));
+  g_assert_cmpint (k, ==, 300);
+  g_assert (hb_set_next (s, &k));
+  g_assert_cmpint (k, ==, 70000);
+  g_assert (!hb_set_next (s, &k));
+
+  hb_set_destroy (s);
+  hb_map_destroy (m);
+}
+
+int
+main (int argc, char **argv)
+{
+  hb_test_init (&argc, &argv);
+
+  hb_test_add (test_map_basic);
+  hb_test_add (test_map_dense_and_sparse);
+  hb_test_add (test_map_keys);
+
+  return hb_test_run();
+}
@@ -365,6 +365,174 @@ test_set_iter (void)
   hb_set_destroy (s);
 }
 
+static void
+test_set_iter_words (void)
+{
+  /* Walk over every word of a page, and each end of every word. */
+  hb_codepoint_t next;
+  hb_set_t *s = hb_set_create ();
+  unsigned int i;
+
+  for (i = 0; i < 8; i++)
+  {
+    hb_set_add (s, 1024 + 64 * i);
+    hb_set_add (s, 1024 + 64 * i + 63);
+  }
+  g_assert_cmpint (hb_set_get_population (s), ==, 16);
+  g_assert_cmpint (hb_set_get_min (s), ==, 1024);
+  g_assert_cmpint (hb_set_get_max (s), ==, 1535);
+
+  next = HB_SET_VALUE_INVALID;
+  for (i = 0; i < 8; i++)
+  {
+    g_assert (hb_set_next (s, &next));
+    g_assert_cmpint (next, ==, 1024 + 64 * i);
+    g_assert (hb_set_next (s, &next));
+    g_assert_cmpint (next, ==, 1024 + 64 * i + 63);
+  }
+  g_assert (!hb_set_next (s, &next));
+
+  next = HB_SET_VALUE_INVALID;
+  for (i = 8; i; i--)
+  {
+    g_assert (hb_set_previous (s, &next));
+    g_assert_cmpint (next, ==, 1024 + 64 * (i - 1) + 63);
+    g_assert (hb_set_previous (s, &next));
+    g_assert_cmpint (next, ==, 1024 + 64 * (i - 1));
+  }
+  g_assert (!hb_set_previous (s, &next));
+
+  hb_set_del (s, 1024);
+  hb_set_del (s, 1535);
+  next = 1100;
+  g_assert (hb_set_next (s, &next));
+  g_assert_cmpint (next, ==, 1151);
+  next = 1100;
+  g_assert (hb_set_previous (s, &next));
+  g_assert_cmpint (next, ==, 1088);
+  g_assert_cmpint (hb_set_get_min (s), ==, 1087);
+  g_assert_cmpint (hb_set_get_max (s), ==, 1472);
+
+  hb_set_add_range (s, 0, 511);
+  g_assert_cmpint (hb_set_get_population (s), ==, 526);
+
+  hb_set_destroy (s);
+}
+
+static void
+test_set_iter_empty_page (void)
+{
+  /* Deleting the last element of a page leaves the page behind, empty;
+   * iterating backwards must go past it. */
+  hb_codepoint_t next, first, last;
+  hb_set_t *s = hb_set_create ();
+
+  hb_set_add (s, 16385);
+  hb_set_del (s, 16385);
+  g_assert (hb_set_is_empty (s));
+
+  next = 17407;
+  g_assert (!hb_set_previous (s, &next));
+  g_assert_cmpint (next, ==, HB_SET_VALUE_INVALID);
+  first = last = 18432;
+  g_assert (!hb_set_previous_range (s, &first, &last));
+  g_assert_cmpint (first, ==, HB_SET_VALUE_INVALID);
+  g_assert_cmpint (last, ==, HB_SET_VALUE_INVALID);
+
+  hb_set_add (s, 10);
+  next = 17407;
+  g_assert (hb_set_previous (s, &next));
+  g_assert_cmpint (next, ==, 10);
+  first = last = 18432;
+  g_assert (hb_set_previous_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 10);
+  g_assert_cmpint (last, ==, 10);
+
+  hb_set_destroy (s);
+}
+
+static void
+test_set_runs (void)
+{
+  /* Sets made of long runs. */
+  hb_codepoint_t first, last;
+  hb_set_t *s = hb_set_create ();
+  hb_set_t *o = hb_set_create ();
+  unsigned int i;
+
+  hb_set_add_range (s, 0, 0x10FFFF);
+  g_assert_cmpint (hb_set_get_population (s), ==, 0x110000);
+  hb_set_del (s, 0x20);
+  hb_set_del_range (s, 0x100, 0x1FF);
+  g_assert_cmpint (hb_set_get_population (s), ==, 0x110000 - 0x101);
+  g_assert (hb_set_has (s, 0x1F));
+  g_assert (!hb_set_has (s, 0x20));
+  g_assert (!hb_set_has (s, 0x1FF));
+  g_assert (hb_set_has (s, 0x200));
+  g_assert (!hb_set_has (s, 0x110000));
+
+  first = last = HB_SET_VALUE_INVALID;
+  g_assert (hb_set_next_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0);
+  g_assert_cmpint (last,  ==, 0x1F);
+  g_assert (hb_set_next_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0x21);
+  g_assert_cmpint (last,  ==, 0xFF);
+  g_assert (hb_set_next_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0x200);
+  g_assert_cmpint (last,  ==, 0x10FFFF);
+  g_assert (!hb_set_next_range (s, &first, &last));
+
+  first = last = HB_SET_VALUE_INVALID;
+  g_assert (hb_set_previous_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0x200);
+  g_assert (hb_set_previous_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0x21);
+  g_assert (hb_set_previous_range (s, &first, &last));
+  g_assert_cmpint (first, ==, 0);
+  g_assert (!hb_set_previous_range (s, &first, &last));
+
+  /* The same set built one codepoint at a time. */
+  for (i = 0; i < 0x1000; i++)
+    if (i != 0x20 && (i < 0x100 || i > 0x1FF))
+      hb_set_add (o, i);
+  hb_set_add_range (o, 0x1000, 0x10FFFF);
+  g_assert (hb_set_is_equal (s, o));
+  g_assert (hb_set_is_subset (o, s));
+  hb_set_del (o, 0x10FFFF);
+  g_assert (!hb_set_is_equal (s, o));
+  g_assert (hb_set_is_subset (o, s));
+  g_assert (!hb_set_is_subset (s, o));
+
+  hb_set_clear (o);
+  hb_set_add (o, 5);
+  hb_set_add (o, 0x20);
+  hb_set_add (o, 0x150);
+  hb_set_add (o, 0x110005);
+  hb_set_union (s, o);
+  g_assert_cmpint (hb_set_get_population (s), ==, 0x110000 - 0xFE);
+  g_assert_cmpint (hb_set_get_max (s), ==, 0x110005);
+  hb_set_intersect (o, s);
+  g_assert_cmpint (hb_set_get_population (o), ==, 4);
+  hb_set_subtract (s, o);
+  g_assert_cmpint (hb_set_get_population (s), ==, 0x110000 - 0x102);
+  g_assert (!hb_set_has (s, 5));
+  g_assert (hb_set_has (s, 6));
+
+  /* Punching many holes into it. */
+  for (i = 0x1000; i < 0x1400; i += 2)
+    hb_set_del (s, i);
+  g_assert_cmpint (hb_set_get_population (s), ==, 0x110000 - 0x102 - 0x200);
+  g_assert (!hb_set_has (s, 0x1000));
+  g_assert (hb_set_has (s, 0x1001));
+  g_assert (hb_set_has (s, 0x1400));
+  hb_set_symmetric_difference (s, s);
+  g_assert (hb_set_is_empty (s));
+
+  hb_set_destroy (o);
+  hb_set_destroy (s);
+}
+
 static void
 test_set_empty (void)
 {
@@ -400,6 +568,9 @@ main (int argc, char **argv)
   hb_test_add (test_set_basic);
   hb_test_add (test_set_algebra);
   hb_test_add (test_set_iter);
+  hb_test_add (test_set_iter_words);
+  hb_test_add (test_set_iter_empty_page);
+  hb_test_add (test_set_runs);
   hb_test_add (test_set_empty);
 
   return hb_test_run();
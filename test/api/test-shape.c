@@ -26,6 +26,8 @@
 
 #include "hb-test.h"
 
+#include <hb-ot.h>
+
 /* Unit tests for hb-shape.h */
 
 /*
@@ -179,6 +181,418 @@ test_shape_clusters (void)
   hb_font_destroy (font);
 }
 
+static hb_unicode_general_category_t
+middle_dot_is_a_mark_general_category (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+				       hb_codepoint_t      unicode,
+				       void               *user_data HB_UNUSED)
+{
+  if (unicode == 0x00B7u)
+    return HB_UNICODE_GENERAL_CATEGORY_NON_SPACING_MARK;
+  return hb_unicode_general_category (hb_unicode_funcs_get_default (), unicode);
+}
+
+static void
+test_shape_unicode_funcs (void)
+{
+  hb_face_t *face;
+  hb_font_t *font;
+  hb_unicode_funcs_t *ufuncs;
+  hb_buffer_t *buffer;
+  unsigned int len, i;
+  hb_glyph_info_t *glyphs;
+  const hb_codepoint_t text[] = {'a', 0x0301, 'a', 0x00B7};
+
+  face = hb_face_create (NULL, 0);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  /* Marks join the cluster of their base, whether the Unicode data come
+   * from the built-in tables or from a user callback. */
+  buffer = hb_buffer_create ();
+  hb_buffer_add_utf32 (buffer, text, 4, 0, 4);
+  hb_buffer_set_direction (buffer, HB_DIRECTION_LTR);
+  hb_shape (font, buffer, NULL, 0);
+
+  {
+    const unsigned int output_clusters[] = {0, 0, 2, 3};
+    len = hb_buffer_get_length (buffer);
+    glyphs = hb_buffer_get_glyph_infos (buffer, NULL);
+    g_assert_cmpint (len, ==, 4);
+    for (i = 0; i < len; i++)
+      g_assert_cmpint (glyphs[i].cluster, ==, output_clusters[i]);
+  }
+
+  ufuncs = hb_unicode_funcs_create (hb_unicode_funcs_get_default ());
+  hb_unicode_funcs_set_general_category_func (ufuncs, middle_dot_is_a_mark_general_category, NULL, NULL);
+
+  hb_buffer_reset (buffer);
+  hb_buffer_set_unicode_funcs (buffer, ufuncs);
+  hb_buffer_add_utf32 (buffer, text, 4, 0, 4);
+  hb_buffer_set_direction (buffer, HB_DIRECTION_LTR);
+  hb_shape (font, buffer, NULL, 0);
+
+  {
+    const unsigned int output_clusters[] = {0, 0, 2, 2};
+    len = hb_buffer_get_length (buffer);
+    glyphs = hb_buffer_get_glyph_infos (buffer, NULL);
+    g_assert_cmpint (len, ==, 4);
+    for (i = 0; i < len; i++)
+      g_assert_cmpint (glyphs[i].cluster, ==, output_clusters[i]);
+  }
+
+  hb_unicode_funcs_destroy (ufuncs);
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (font);
+}
+
+typedef struct
+{
+  unsigned int calls;
+  unsigned int stages;
+  unsigned int lookups;
+  hb_bool_t destroyed;
+} profile_t;
+
+static void
+profile_func (hb_buffer_t *buffer HB_UNUSED,
+	      hb_font_t *font HB_UNUSED,
+	      const hb_buffer_profile_counters_t *counters,
+	      void *user_data)
+{
+  profile_t *profile = (profile_t *) user_data;
+  profile->calls++;
+  g_assert_cmpint (counters->stage, <=, HB_BUFFER_PROFILE_STAGE_LOOKUP);
+  profile->stages |= 1u << counters->stage;
+  if (counters->stage == HB_BUFFER_PROFILE_STAGE_LOOKUP)
+  {
+    profile->lookups++;
+    g_assert (counters->table_tag == HB_TAG ('G','S','U','B') ||
+	      counters->table_tag == HB_TAG ('G','P','O','S'));
+    g_assert_cmpuint (counters->lookups_run, ==, 0);
+    g_assert_cmpuint (counters->lookups_skipped, ==, 0);
+  }
+  else
+  {
+    g_assert_cmphex (counters->table_tag, ==, 0);
+    g_assert_cmpuint (counters->lookup_index, ==, 0);
+  }
+  if (counters->stage == HB_BUFFER_PROFILE_STAGE_NORMALIZE)
+  {
+    g_assert_cmpuint (counters->glyphs_in, ==, 4);
+    g_assert_cmpuint (counters->glyphs_out, ==, 4);
+    g_assert_cmpuint (counters->lookups_run, ==, 0);
+    g_assert_cmpuint (counters->lookups_skipped, ==, 0);
+  }
+}
+
+static void
+profile_destroy (void *user_data)
+{
+  ((profile_t *) user_data)->destroyed = TRUE;
+}
+
+static void
+test_shape_profile (void)
+{
+  hb_face_t *face;
+  hb_font_t *font;
+  hb_buffer_t *buffer;
+  profile_t profile = {0, 0, 0, FALSE};
+
+  face = hb_face_create (NULL, 0);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  buffer = hb_buffer_create ();
+  hb_buffer_set_direction (buffer, HB_DIRECTION_LTR);
+  hb_buffer_add_utf8 (buffer, TesT, 4, 0, 4);
+  hb_buffer_set_profile_func (buffer, profile_func, &profile, profile_destroy);
+
+  hb_shape (font, buffer, NULL, 0);
+
+  hb_buffer_destroy (buffer);
+  g_assert (profile.destroyed);
+  hb_font_destroy (font);
+
+#ifdef HB_PROFILE
+  /* Every stage the plan runs is reported; the face has no lookups and
+   * no kern table. */
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_NORMALIZE), !=, 0);
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_SETUP_MASKS), !=, 0);
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_SUBSTITUTE), !=, 0);
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_POSITION), !=, 0);
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_HIDE_DEFAULT_IGNORABLES), !=, 0);
+  g_assert_cmphex (profile.stages & (1u << HB_BUFFER_PROFILE_STAGE_KERN), ==, 0);
+  g_assert_cmpuint (profile.lookups, ==, 0);
+#else
+  /* The function is never called. */
+  g_assert_cmpuint (profile.calls, ==, 0);
+  g_test_skip ("Built without HB_PROFILE");
+#endif
+}
+
+
+typedef struct
+{
+  unsigned int calls;
+  unsigned int lookups_run;
+  unsigned int lookups_skipped;
+} lookup_profile_t;
+
+static void
+lookup_profile_func (hb_buffer_t *buffer HB_UNUSED,
+		     hb_font_t *font HB_UNUSED,
+		     const hb_buffer_profile_counters_t *counters,
+		     void *user_data)
+{
+  lookup_profile_t *profile = (lookup_profile_t *) user_data;
+  profile->calls++;
+  /* The lookups are counted in the stage that runs them, not in their own
+   * reports. */
+  if (counters->stage == HB_BUFFER_PROFILE_STAGE_LOOKUP)
+    return;
+  profile->lookups_run += counters->lookups_run;
+  profile->lookups_skipped += counters->lookups_skipped;
+}
+
+static void
+shape_with_lookup_profile (hb_font_t *font, const char *text, lookup_profile_t *profile)
+{
+  hb_buffer_t *buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, text, -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_buffer_set_profile_func (buffer, lookup_profile_func, profile, NULL);
+  hb_shape (font, buffer, NULL, 0);
+  hb_buffer_destroy (buffer);
+}
+
+static void
+test_shape_profile_lookups (void)
+{
+  hb_face_t *face;
+  hb_font_t *font;
+  lookup_profile_t profile_fi = {0, 0, 0};
+  lookup_profile_t profile_ii = {0, 0, 0};
+  gchar *path;
+  hb_blob_t *blob;
+
+  /* The font's GSUB has the f_i ligature, and nothing else. */
+  path = g_test_build_filename (G_TEST_DIST, "fonts/Roboto-Regular.gsub.fi.ttf", NULL);
+  blob = hb_blob_create_from_file (path);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+  g_free (path);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  shape_with_lookup_profile (font, "fi", &profile_fi);
+  shape_with_lookup_profile (font, "ii", &profile_ii);
+
+  hb_font_destroy (font);
+
+#ifdef HB_PROFILE
+  /* The ligature lookup runs on "fi"; with no "f" in "ii" it is skipped. */
+  g_assert_cmpuint (profile_fi.lookups_run, >, 0);
+  g_assert_cmpuint (profile_ii.lookups_skipped, >, 0);
+  g_assert_cmpuint (profile_ii.lookups_run, <, profile_fi.lookups_run);
+#else
+  g_assert_cmpuint (profile_fi.calls, ==, 0);
+  g_assert_cmpuint (profile_ii.calls, ==, 0);
+  g_test_skip ("Built without HB_PROFILE");
+#endif
+}
+
+static void
+test_shape_lookups_without_index (void)
+{
+  hb_face_t *face;
+  hb_font_t *font;
+  hb_buffer_t *buffer;
+  hb_glyph_info_t *info;
+  lookup_profile_t profile = {0, 0, 0};
+  unsigned int len;
+  gchar *path;
+  hb_blob_t *blob;
+
+  /* The font's 131 ccmp lookups reach glyph 65534, which puts the lookup
+   * index over its budget, so lookups are filtered through a digest of
+   * the buffer.  Lookup 0 maps glyph 1 ("a") to 2, lookup 129 maps 2 to
+   * 3 and lookup 130 maps 65534 to 65533.  Lookups 1 to 128 cover glyph
+   * 32769, which the digest can't tell from glyph 1. */
+  path = g_test_build_filename (G_TEST_DIST, "fonts/lookup-index-over-budget.ttf", NULL);
+  blob = hb_blob_create_from_file (path);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+  g_free (path);
+  font = hb_font_create (face);
+  hb_face_destroy (face);
+
+  buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, "aa", -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_buffer_set_profile_func (buffer, lookup_profile_func, &profile, NULL);
+  hb_shape (font, buffer, NULL, 0);
+
+  /* Lookup 129 only applies to what lookup 0 output. */
+  info = hb_buffer_get_glyph_infos (buffer, &len);
+  g_assert_cmpuint (len, ==, 2);
+  g_assert_cmpuint (info[0].codepoint, ==, 3);
+  g_assert_cmpuint (info[1].codepoint, ==, 3);
+
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (font);
+
+#ifdef HB_PROFILE
+  /* The index would have run lookups 0 and 129 only. */
+  g_assert_cmpuint (profile.lookups_run, ==, 130);
+  g_assert_cmpuint (profile.lookups_skipped, ==, 1);
+#else
+  g_assert_cmpuint (profile.calls, ==, 0);
+  g_test_skip ("Built without HB_PROFILE");
+#endif
+}
+
+static void
+test_shape_batch (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_font_t *font;
+  hb_buffer_t *buffer, *single;
+  const char text[] = "fiiifif";
+  unsigned int ends[3] = {2, 4, 7};
+  unsigned int bad_ends[2] = {4, 2};
+  unsigned int i, start, glyph_start;
+  gchar *path;
+
+  path = g_test_build_filename (G_TEST_DIST, "fonts/Roboto-Regular.gsub.fi.ttf", NULL);
+  blob = hb_blob_create_from_file (path);
+  face = hb_face_create (blob, 0);
+  font = hb_font_create (face);
+  hb_blob_destroy (blob);
+  g_free (path);
+
+  buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, text, -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+
+  /* The runs must cover the buffer, in order. */
+  g_assert (!hb_shape_batch (font, buffer, bad_ends, 2, NULL, 0, NULL));
+  g_assert_cmpuint (hb_buffer_get_length (buffer), ==, 7);
+  g_assert_cmpint (hb_buffer_get_content_type (buffer), ==, HB_BUFFER_CONTENT_TYPE_UNICODE);
+
+  g_assert (hb_shape_batch (font, buffer, ends, 3, NULL, 0, NULL));
+  g_assert_cmpint (hb_buffer_get_content_type (buffer), ==, HB_BUFFER_CONTENT_TYPE_GLYPHS);
+  g_assert_cmpuint (ends[2], ==, hb_buffer_get_length (buffer));
+
+  /* Each run comes out as if shaped on its own. */
+  single = hb_buffer_create ();
+  start = glyph_start = 0;
+  for (i = 0; i < 3; i++)
+  {
+    static const unsigned int run_ends[3] = {2, 4, 7};
+    hb_glyph_info_t *info, *single_info;
+    hb_glyph_position_t *pos, *single_pos;
+    unsigned int len, j;
+
+    hb_buffer_clear_contents (single);
+    hb_buffer_add_utf8 (single, text + start, run_ends[i] - start, 0, -1);
+    hb_buffer_guess_segment_properties (single);
+    hb_shape (font, single, NULL, 0);
+
+    info = hb_buffer_get_glyph_infos (buffer, NULL);
+    pos = hb_buffer_get_glyph_positions (buffer, NULL);
+    single_info = hb_buffer_get_glyph_infos (single, &len);
+    single_pos = hb_buffer_get_glyph_positions (single, NULL);
+    g_assert_cmpuint (ends[i] - glyph_start, ==, len);
+    for (j = 0; j < len; j++)
+    {
+      g_assert_cmpuint (info[glyph_start + j].codepoint, ==, single_info[j].codepoint);
+      g_assert_cmpuint (info[glyph_start + j].cluster, ==, single_info[j].cluster + start);
+      g_assert_cmpint (pos[glyph_start + j].x_advance, ==, single_pos[j].x_advance);
+    }
+
+    start = run_ends[i];
+    glyph_start = ends[i];
+  }
+  /* The "fi" ligature formed in the first and the last run. */
+  g_assert_cmpuint (ends[0], ==, 1);
+  g_assert_cmpuint (ends[2], ==, 5);
+
+  hb_buffer_destroy (single);
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (font);
+  hb_face_destroy (face);
+}
+
+/* Maps 'x' to the glyph of 'f' plus 0x10000: a glyph the font doesn't
+ * have, that shares its low 16 bits with one that kerns. */
+static hb_bool_t
+high_glyph_nominal_glyph (hb_font_t *font,
+			  void *font_data HB_UNUSED,
+			  hb_codepoint_t unicode,
+			  hb_codepoint_t *glyph,
+			  void *user_data HB_UNUSED)
+{
+  if (unicode == 'x')
+  {
+    if (!hb_font_get_nominal_glyph (hb_font_get_parent (font), 'f', glyph))
+      return FALSE;
+    *glyph |= 0x10000u;
+    return TRUE;
+  }
+  return hb_font_get_nominal_glyph (hb_font_get_parent (font), unicode, glyph);
+}
+
+static void
+test_shape_pair_cache_high_glyphs (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_font_t *parent, *font;
+  hb_font_funcs_t *ffuncs;
+  hb_buffer_t *buffer;
+  hb_glyph_info_t *info;
+  hb_glyph_position_t *pos;
+  unsigned int len, i;
+  gchar *path;
+
+  /* The font kerns "fg". */
+  path = g_test_build_filename (G_TEST_DIST, "fonts/Roboto-Regular.components.ttf", NULL);
+  blob = hb_blob_create_from_file (path);
+  face = hb_face_create (blob, 0);
+  parent = hb_font_create (face);
+  hb_blob_destroy (blob);
+  g_free (path);
+
+  font = hb_font_create_sub_font (parent);
+  ffuncs = hb_font_funcs_create ();
+  hb_font_funcs_set_nominal_glyph_func (ffuncs, high_glyph_nominal_glyph, NULL, NULL);
+  hb_font_set_funcs (font, ffuncs, NULL, NULL);
+  hb_font_funcs_destroy (ffuncs);
+
+  /* Long enough for GPOS to cache pairs; "xg" must not pick up the
+   * kerning cached for "fg". */
+  buffer = hb_buffer_create ();
+  hb_buffer_add_utf8 (buffer, "fgxgfgxgfgxgfgxgfgxgfgxgfgxgfgxgfgxgfgxg", -1, 0, -1);
+  hb_buffer_guess_segment_properties (buffer);
+  hb_shape (font, buffer, NULL, 0);
+
+  info = hb_buffer_get_glyph_infos (buffer, &len);
+  pos = hb_buffer_get_glyph_positions (buffer, NULL);
+  g_assert_cmpuint (len, ==, 40);
+  g_assert_cmpint (pos[0].x_advance, <, hb_font_get_glyph_h_advance (font, info[0].codepoint));
+  for (i = 0; i < len; i += 4)
+  {
+    g_assert_cmpint (pos[i].x_advance, ==, pos[0].x_advance);
+    g_assert_cmpint (pos[i + 2].x_advance, ==, hb_font_get_glyph_h_advance (font, info[i + 2].codepoint));
+  }
+
+  hb_buffer_destroy (buffer);
+  hb_font_destroy (font);
+  hb_font_destroy (parent);
+  hb_face_destroy (face);
+}
 
 static void
 test_shape_list (void)
@@ -193,6 +607,275 @@ test_shape_list (void)
   g_assert (!strcmp (shapers[i - 1], "fallback"));
 }
 
+static void
+test_shape_plan_cache (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_segment_properties_t props = HB_SEGMENT_PROPERTIES_DEFAULT;
+  hb_feature_t features[2];
+  hb_shape_plan_t *plan1, *plan2, *plan3;
+  unsigned int hits, misses, evictions;
+
+  blob = hb_blob_create (test_data, sizeof (test_data), HB_MEMORY_MODE_READONLY, NULL, NULL);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+
+  props.direction = HB_DIRECTION_LTR;
+  props.script = HB_SCRIPT_LATIN;
+  g_assert (hb_feature_from_string ("kern", -1, &features[0]));
+  g_assert (hb_feature_from_string ("liga=0", -1, &features[1]));
+
+  plan1 = hb_shape_plan_create_cached (face, &props, &features[0], 1, NULL);
+  plan2 = hb_shape_plan_create_cached (face, &props, &features[0], 1, NULL);
+  g_assert (plan1 == plan2);
+  hb_shape_plan_destroy (plan2);
+
+  hb_shape_plan_cache_get_stats (face, &hits, &misses, &evictions);
+  g_assert_cmpuint (hits, ==, 1);
+  g_assert_cmpuint (misses, ==, 1);
+  g_assert_cmpuint (evictions, ==, 0);
+
+  /* A full cache makes room by evicting. */
+  hb_shape_plan_cache_set_size (face, 1);
+  g_assert_cmpuint (hb_shape_plan_cache_get_size (face), ==, 1);
+  plan2 = hb_shape_plan_create_cached (face, &props, &features[1], 1, NULL);
+  g_assert (plan2 != plan1);
+  plan3 = hb_shape_plan_create_cached (face, &props, &features[1], 1, NULL);
+  g_assert (plan3 == plan2);
+  hb_shape_plan_destroy (plan3);
+
+  hb_shape_plan_cache_get_stats (face, &hits, &misses, &evictions);
+  g_assert_cmpuint (hits, ==, 2);
+  g_assert_cmpuint (misses, ==, 2);
+  g_assert_cmpuint (evictions, ==, 1);
+
+  /* The evicted plan stays valid while referenced. */
+  g_assert_cmpstr (hb_shape_plan_get_shaper (plan1), ==, hb_shape_plan_get_shaper (plan2));
+  hb_shape_plan_destroy (plan1);
+  hb_shape_plan_destroy (plan2);
+
+  /* Size zero disables caching. */
+  hb_shape_plan_cache_set_size (face, 0);
+  plan1 = hb_shape_plan_create_cached (face, &props, &features[1], 1, NULL);
+  plan2 = hb_shape_plan_create_cached (face, &props, &features[1], 1, NULL);
+  g_assert (plan1 != plan2);
+  hb_shape_plan_destroy (plan1);
+  hb_shape_plan_destroy (plan2);
+
+  hb_face_destroy (face);
+}
+
+static void
+test_shape_plan_cache_variations (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_segment_properties_t props = HB_SEGMENT_PROPERTIES_DEFAULT;
+  int coords1[1] = {-8192}, coords2[1] = {16384};
+  hb_shape_plan_t *plan1, *plan2, *plan3;
+  gchar *path;
+
+  blob = hb_blob_create (test_data, sizeof (test_data), HB_MEMORY_MODE_READONLY, NULL, NULL);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+
+  props.direction = HB_DIRECTION_LTR;
+  props.script = HB_SCRIPT_LATIN;
+
+  /* The font has no FeatureVariations, so every instance shares one plan. */
+  plan1 = hb_shape_plan_create_cached2 (face, &props, NULL, 0, coords1, 1, NULL);
+  plan2 = hb_shape_plan_create_cached2 (face, &props, NULL, 0, coords2, 1, NULL);
+  plan3 = hb_shape_plan_create_cached2 (face, &props, NULL, 0, NULL, 0, NULL);
+  g_assert (plan1 == plan2);
+  g_assert (plan1 == plan3);
+  hb_shape_plan_destroy (plan1);
+  hb_shape_plan_destroy (plan2);
+  hb_shape_plan_destroy (plan3);
+
+  hb_face_destroy (face);
+
+  /* This one has a FeatureVariations record in GSUB that applies from
+   * somewhat lighter than the default instance up to the default. */
+  path = g_test_build_filename (G_TEST_DIST, "fonts/AdobeVFPrototype-Subset.otf", NULL);
+  blob = hb_blob_create_from_file (path);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+  g_free (path);
+
+  {
+    int light1[1] = {-2048}, light2[1] = {-1024};
+    int bold[1] = {8192}, lightest[1] = {-16384};
+    unsigned int index;
+    hb_shape_plan_t *plan_light1, *plan_light2, *plan_bold, *plan_lightest, *plan_default;
+
+    g_assert (hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB, light1, 1, &index));
+    g_assert_cmpuint (index, ==, 0);
+    g_assert (hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB, light2, 1, &index));
+    g_assert_cmpuint (index, ==, 0);
+    g_assert (!hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB, bold, 1, &index));
+    g_assert (!hb_ot_layout_table_find_feature_variations (face, HB_OT_TAG_GSUB, lightest, 1, &index));
+
+    plan_light1 = hb_shape_plan_create_cached2 (face, &props, NULL, 0, light1, 1, NULL);
+    plan_light2 = hb_shape_plan_create_cached2 (face, &props, NULL, 0, light2, 1, NULL);
+    plan_bold = hb_shape_plan_create_cached2 (face, &props, NULL, 0, bold, 1, NULL);
+    plan_lightest = hb_shape_plan_create_cached2 (face, &props, NULL, 0, lightest, 1, NULL);
+    plan_default = hb_shape_plan_create_cached2 (face, &props, NULL, 0, NULL, 0, NULL);
+
+    /* Same variations index, same plan. */
+    g_assert (plan_light1 == plan_light2);
+    g_assert (plan_light1 == plan_default);
+    /* No record applies to either of these. */
+    g_assert (plan_bold == plan_lightest);
+    /* Different indices, different plans. */
+    g_assert (plan_light1 != plan_bold);
+
+    hb_shape_plan_destroy (plan_light1);
+    hb_shape_plan_destroy (plan_light2);
+    hb_shape_plan_destroy (plan_bold);
+    hb_shape_plan_destroy (plan_lightest);
+    hb_shape_plan_destroy (plan_default);
+  }
+
+  {
+    /* Only the ot shaper looks at FeatureVariations. */
+    const char *fallback[] = {"fallback", NULL};
+    int light[1] = {-2048}, bold[1] = {8192};
+    hb_shape_plan_t *plan_light, *plan_bold;
+
+    plan_light = hb_shape_plan_create_cached2 (face, &props, NULL, 0, light, 1, fallback);
+    plan_bold = hb_shape_plan_create_cached2 (face, &props, NULL, 0, bold, 1, fallback);
+    g_assert_cmpstr (hb_shape_plan_get_shaper (plan_light), ==, "fallback");
+    g_assert (plan_light == plan_bold);
+
+    hb_shape_plan_destroy (plan_light);
+    hb_shape_plan_destroy (plan_bold);
+  }
+
+  hb_face_destroy (face);
+}
+
+static void
+test_shape_plan_cache_ranges (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  hb_segment_properties_t props = HB_SEGMENT_PROPERTIES_DEFAULT;
+  hb_feature_t features[3];
+  hb_shape_plan_t *plan1, *plan2, *plan3;
+
+  blob = hb_blob_create (test_data, sizeof (test_data), HB_MEMORY_MODE_READONLY, NULL, NULL);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+
+  props.direction = HB_DIRECTION_LTR;
+  props.script = HB_SCRIPT_LATIN;
+  g_assert (hb_feature_from_string ("liga[0:2]=0", -1, &features[0]));
+  g_assert (hb_feature_from_string ("liga[3:5]=0", -1, &features[1]));
+  g_assert (hb_feature_from_string ("liga=0", -1, &features[2]));
+
+  /* Ranges are applied at shape time; only global-ness affects the plan. */
+  plan1 = hb_shape_plan_create_cached (face, &props, &features[0], 1, NULL);
+  plan2 = hb_shape_plan_create_cached (face, &props, &features[1], 1, NULL);
+  plan3 = hb_shape_plan_create_cached (face, &props, &features[2], 1, NULL);
+  g_assert (plan1 == plan2);
+  g_assert (plan1 != plan3);
+  hb_shape_plan_destroy (plan1);
+  hb_shape_plan_destroy (plan2);
+  hb_shape_plan_destroy (plan3);
+
+  hb_face_destroy (face);
+}
+
+#define CHURN_MAX_PLANS 8
+#define CHURN_NUM_THREADS 8
+#define CHURN_NUM_FEATURES 64
+
+typedef struct
+{
+  hb_face_t *face;
+  unsigned int seed;
+} churn_thread_t;
+
+static hb_user_data_key_t churn_key;
+static int churn_live_plans;
+
+static void
+churn_plan_destroyed (void *user_data G_GNUC_UNUSED)
+{
+  g_atomic_int_add (&churn_live_plans, -1);
+}
+
+static gpointer
+churn_thread_func (gpointer data)
+{
+  churn_thread_t *thread = (churn_thread_t *) data;
+  hb_segment_properties_t props = HB_SEGMENT_PROPERTIES_DEFAULT;
+  hb_feature_t feature;
+  unsigned int i;
+
+  props.direction = HB_DIRECTION_LTR;
+  props.script = HB_SCRIPT_LATIN;
+  g_assert (hb_feature_from_string ("liga", -1, &feature));
+
+  for (i = 0; i < 2000; i++)
+  {
+    hb_shape_plan_t *plan;
+
+    /* Odd threads keep hitting the same plan, so lookups are in progress
+     * most of the time; even ones cycle through all the combinations. */
+    feature.value = thread->seed & 1 ? 1 : (thread->seed + i * 7) % CHURN_NUM_FEATURES;
+    plan = hb_shape_plan_create_cached (thread->face, &props, &feature, 1, NULL);
+    if (hb_shape_plan_set_user_data (plan, &churn_key, NULL, churn_plan_destroyed, FALSE))
+      g_atomic_int_inc (&churn_live_plans);
+
+    /* The cached plans, one held by each thread, and one that was just
+     * evicted but not released yet. */
+    g_assert_cmpint (g_atomic_int_get (&churn_live_plans), <=, CHURN_MAX_PLANS + CHURN_NUM_THREADS + 1);
+
+    hb_shape_plan_destroy (plan);
+  }
+
+  return NULL;
+}
+
+static void
+test_shape_plan_cache_churn (void)
+{
+  hb_blob_t *blob;
+  hb_face_t *face;
+  churn_thread_t threads[CHURN_NUM_THREADS];
+  GThread *handles[CHURN_NUM_THREADS];
+  unsigned int hits, misses, evictions;
+  unsigned int i;
+
+  blob = hb_blob_create (test_data, sizeof (test_data), HB_MEMORY_MODE_READONLY, NULL, NULL);
+  face = hb_face_create (blob, 0);
+  hb_blob_destroy (blob);
+
+  /* Many more feature combinations than the cache holds, requested from
+   * several threads at once: evicted plans must be released as they go,
+   * not pile up while lookups are in progress. */
+  hb_shape_plan_cache_set_size (face, CHURN_MAX_PLANS);
+
+  for (i = 0; i < CHURN_NUM_THREADS; i++)
+  {
+    threads[i].face = face;
+    threads[i].seed = i;
+    handles[i] = g_thread_new ("churn", churn_thread_func, &threads[i]);
+  }
+  for (i = 0; i < CHURN_NUM_THREADS; i++)
+    g_thread_join (handles[i]);
+
+  g_assert_cmpint (g_atomic_int_get (&churn_live_plans), <=, CHURN_MAX_PLANS);
+  hb_shape_plan_cache_get_stats (face, &hits, &misses, &evictions);
+  g_assert_cmpuint (evictions, >, 0);
+  g_assert_cmpuint (hits + misses, ==, CHURN_NUM_THREADS * 2000);
+
+  hb_face_destroy (face);
+  g_assert_cmpint (churn_live_plans, ==, 0);
+}
+
 int
 main (int argc, char **argv)
 {
@@ -200,9 +883,19 @@ main (int argc, char **argv)
 
   hb_test_add (test_shape);
   hb_test_add (test_shape_clusters);
+  hb_test_add (test_shape_unicode_funcs);
+  hb_test_add (test_shape_profile);
+  hb_test_add (test_shape_profile_lookups);
+  hb_test_add (test_shape_lookups_without_index);
   /* TODO test fallback shaper */
   /* TODO test shaper_full */
+  hb_test_add (test_shape_batch);
+  hb_test_add (test_shape_pair_cache_high_glyphs);
   hb_test_add (test_shape_list);
+  hb_test_add (test_shape_plan_cache);
+  hb_test_add (test_shape_plan_cache_variations);
+  hb_test_add (test_shape_plan_cache_ranges);
+  hb_test_add (test_shape_plan_cache_churn);
 
   return hb_test_run();
 }
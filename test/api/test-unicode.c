@@ -661,6 +661,151 @@ test_unicode_subclassing_deep (data_fixture_t *f, gconstpointer user_data HB_UNU
   g_assert (f->data[0].freed && f->data[1].freed);
 }
 
+static hb_bool_t
+ab_is_for_x_compose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+		     hb_codepoint_t      a,
+		     hb_codepoint_t      b,
+		     hb_codepoint_t     *ab,
+		     void               *user_data HB_UNUSED)
+{
+  if (a != 'a' || b != 'b')
+    return FALSE;
+  *ab = 'x';
+  return TRUE;
+}
+
+static hb_bool_t
+x_is_for_ab_decompose (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+		       hb_codepoint_t      ab,
+		       hb_codepoint_t     *a,
+		       hb_codepoint_t     *b,
+		       void               *user_data HB_UNUSED)
+{
+  if (ab != 'x')
+    return FALSE;
+  *a = 'a';
+  *b = 'b';
+  return TRUE;
+}
+
+static void
+test_unicode_subclassing_normalization (void)
+{
+  hb_unicode_funcs_t *uf;
+  hb_codepoint_t a, b, ab;
+
+  /* The default funcs skip characters canonical normalization cannot
+   * touch; make sure that does not leak into user callbacks. */
+  uf = hb_unicode_funcs_create (hb_unicode_funcs_get_default ());
+
+  g_assert (!hb_unicode_compose (uf, 'a', 'b', &ab));
+  g_assert (!hb_unicode_decompose (uf, 'x', &a, &b));
+
+  hb_unicode_funcs_set_compose_func (uf, ab_is_for_x_compose, NULL, NULL);
+  hb_unicode_funcs_set_decompose_func (uf, x_is_for_ab_decompose, NULL, NULL);
+
+  g_assert (hb_unicode_compose (uf, 'a', 'b', &ab) && ab == 'x');
+  g_assert (hb_unicode_decompose (uf, 'x', &a, &b) && a == 'a' && b == 'b');
+  g_assert (!hb_unicode_compose (uf, 0x0041, 0x030A, &ab));
+  g_assert (!hb_unicode_decompose (uf, 0x00C5, &a, &b));
+
+  hb_unicode_funcs_set_compose_func (uf, NULL, NULL, NULL);
+  hb_unicode_funcs_set_decompose_func (uf, NULL, NULL, NULL);
+
+  g_assert (!hb_unicode_compose (uf, 'a', 'b', &ab));
+  g_assert (!hb_unicode_decompose (uf, 'x', &a, &b));
+  g_assert (hb_unicode_compose (uf, 0x0041, 0x030A, &ab) && ab == 0x00C5);
+  g_assert (hb_unicode_decompose (uf, 0x00C5, &a, &b) && a == 0x0041 && b == 0x030A);
+
+  hb_unicode_funcs_destroy (uf);
+}
+
+static void
+test_unicode_batch (gconstpointer user_data)
+{
+  hb_unicode_funcs_t *uf = (hb_unicode_funcs_t *) user_data;
+  struct {
+    hb_codepoint_t unicode;
+    hb_unicode_general_category_t category;
+    hb_script_t script;
+  } chars[300];
+  hb_codepoint_t u;
+  unsigned int i;
+
+  /* Reads and writes through strides, across all of Unicode and a bit past. */
+  for (u = 0; u < 0x110000 + G_N_ELEMENTS (chars); u += G_N_ELEMENTS (chars))
+  {
+    for (i = 0; i < G_N_ELEMENTS (chars); i++)
+      chars[i].unicode = u + i;
+
+    hb_unicode_general_categories (uf, G_N_ELEMENTS (chars),
+				   &chars[0].unicode, sizeof (chars[0]),
+				   &chars[0].category, sizeof (chars[0]));
+    hb_unicode_scripts (uf, G_N_ELEMENTS (chars),
+			&chars[0].unicode, sizeof (chars[0]),
+			&chars[0].script, sizeof (chars[0]));
+
+    for (i = 0; i < G_N_ELEMENTS (chars); i++)
+    {
+      g_assert_cmpint (chars[i].category, ==, hb_unicode_general_category (uf, chars[i].unicode));
+      g_assert_cmphex (chars[i].script, ==, hb_unicode_script (uf, chars[i].unicode));
+    }
+  }
+}
+
+static hb_script_t
+a_is_for_arabic_script (hb_unicode_funcs_t *ufuncs HB_UNUSED,
+			hb_codepoint_t      unicode,
+			void               *user_data HB_UNUSED)
+{
+  return unicode == 'a' ? HB_SCRIPT_ARABIC : hb_unicode_script (hb_unicode_funcs_get_default (), unicode);
+}
+
+static void
+all_arabic_scripts (hb_unicode_funcs_t   *ufuncs HB_UNUSED,
+		    unsigned int          count,
+		    const hb_codepoint_t *first_unicode HB_UNUSED,
+		    unsigned int          unicode_stride HB_UNUSED,
+		    hb_script_t          *first_script,
+		    unsigned int          script_stride,
+		    void                 *user_data HB_UNUSED)
+{
+  unsigned int i;
+  for (i = 0; i < count; i++)
+    *(hb_script_t *) ((char *) first_script + i * script_stride) = HB_SCRIPT_ARABIC;
+}
+
+static void
+test_unicode_subclassing_batch (void)
+{
+  hb_unicode_funcs_t *uf;
+  const hb_codepoint_t text[] = {'a', 'b'};
+  hb_script_t scripts[2];
+
+  /* The batch functions follow an overridden simple function... */
+  uf = hb_unicode_funcs_create (hb_unicode_funcs_get_default ());
+  hb_unicode_funcs_set_script_func (uf, a_is_for_arabic_script, NULL, NULL);
+
+  hb_unicode_scripts (uf, 2, text, sizeof (text[0]), scripts, sizeof (scripts[0]));
+  g_assert_cmphex (scripts[0], ==, HB_SCRIPT_ARABIC);
+  g_assert_cmphex (scripts[1], ==, HB_SCRIPT_LATIN);
+
+  /* ...unless overridden themselves. */
+  hb_unicode_funcs_set_scripts_func (uf, all_arabic_scripts, NULL, NULL);
+
+  hb_unicode_scripts (uf, 2, text, sizeof (text[0]), scripts, sizeof (scripts[0]));
+  g_assert_cmphex (scripts[0], ==, HB_SCRIPT_ARABIC);
+  g_assert_cmphex (scripts[1], ==, HB_SCRIPT_ARABIC);
+
+  hb_unicode_funcs_destroy (uf);
+
+  /* The empty funcs batch the nil functions. */
+  uf = hb_unicode_funcs_get_empty ();
+  hb_unicode_scripts (uf, 2, text, sizeof (text[0]), scripts, sizeof (scripts[0]));
+  g_assert_cmphex (scripts[0], ==, HB_SCRIPT_UNKNOWN);
+  g_assert_cmphex (scripts[1], ==, HB_SCRIPT_UNKNOWN);
+}
+
 
 static hb_script_t
 script_roundtrip_default (hb_script_t script)
@@ -798,15 +943,18 @@ main (int argc, char **argv)
 
   hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_properties);
   hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_normalization);
+  hb_test_add_data_flavor (hb_unicode_funcs_get_default (),          "default", test_unicode_batch);
   hb_test_add_data_flavor ((gconstpointer) script_roundtrip_default, "default", test_unicode_script_roundtrip);
 #ifdef HAVE_GLIB
   hb_test_add_data_flavor (hb_glib_get_unicode_funcs (),             "glib",    test_unicode_properties);
   hb_test_add_data_flavor (hb_glib_get_unicode_funcs (),             "glib",    test_unicode_normalization);
+  hb_test_add_data_flavor (hb_glib_get_unicode_funcs (),             "glib",    test_unicode_batch);
   hb_test_add_data_flavor ((gconstpointer) script_roundtrip_glib,    "glib",    test_unicode_script_roundtrip);
 #endif
 #ifdef HAVE_ICU
   hb_test_add_data_flavor (hb_icu_get_unicode_funcs (),              "icu",     test_unicode_properties);
   hb_test_add_data_flavor (hb_icu_get_unicode_funcs (),              "icu",     test_unicode_normalization);
+  hb_test_add_data_flavor (hb_icu_get_unicode_funcs (),              "icu",     test_unicode_batch);
   hb_test_add_data_flavor ((gconstpointer) script_roundtrip_icu,     "icu",     test_unicode_script_roundtrip);
 #endif
 
@@ -817,6 +965,8 @@ main (int argc, char **argv)
   hb_test_add_fixture (data_fixture, NULL, test_unicode_subclassing_nil);
   hb_test_add_fixture (data_fixture, NULL, test_unicode_subclassing_default);
   hb_test_add_fixture (data_fixture, NULL, test_unicode_subclassing_deep);
+  hb_test_add (test_unicode_subclassing_normalization);
+  hb_test_add (test_unicode_subclassing_batch);
 
   return hb_test_run ();
 }